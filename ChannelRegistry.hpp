@@ -0,0 +1,363 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file ChannelRegistry.hpp
+///
+/// For creating and destroying signal chain channels at run time without the heap
+///
+/// @par Full Description
+/// Class header and implementation of the ChannelRegistry class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(CHANNEL_REGISTRY_HPP)
+#define CHANNEL_REGISTRY_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <new>
+#include <utility>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    // Handle of a channel in a ChannelRegistry, the generation in the top 16 bits and the slot in the bottom 16
+    typedef uint32_t ChannelHandle;
+
+    // Never returned for a channel, so usable to mean none
+    static const ChannelHandle INVALID_CHANNEL_HANDLE = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: ChannelRegistry
+    ///
+    /// Fixed capacity store of channel objects addressed by generation checked handles
+    ///
+    /// @par Full Description
+    /// Replaces new and delete of RateOfChange and the other signal chain objects when a recipe is loaded.  All
+    /// CAPACITY objects' worth of storage is part of the registry, so creating and destroying channels never calls the
+    /// general purpose allocator and cannot fragment the heap or stall on it.
+    ///
+    /// The live objects are kept packed at the start of the storage, so iterating over every channel with
+    /// GetChannels and GetCount is a walk along one contiguous array.  Destroying a channel moves the last object
+    /// into the hole it leaves, which is why T must be move or copy constructible, and why a pointer to a channel is
+    /// only good until the next Destroy.  The handle is what stays stable: it names a slot that follows the object
+    /// when it moves.  Each slot carries a generation that changes when its channel is destroyed, so a handle kept
+    /// past Destroy or Clear is rejected by Get rather than reaching whichever channel took the slot next.
+    ///
+    /// Not thread safe, a registry is configured and scanned from one context.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, uint32_t CAPACITY>
+class ChannelRegistry
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::ChannelRegistry
+        ///
+        /// Constructor, the registry starts empty
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ChannelRegistry();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::~ChannelRegistry
+        ///
+        /// Destructor, destroys the channels still live
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ChannelRegistry() { Clear(); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::Create
+        ///
+        /// Construct a channel in the registry.
+        ///
+        /// @param  [in]  rArgs   Arguments for the constructor of T.
+        ///
+        /// @return handle of the channel, INVALID_CHANNEL_HANDLE when the registry is full
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename... Args>
+        ChannelHandle Create(Args &&... rArgs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::Destroy
+        ///
+        /// Destroy a channel, moving the last channel into its place.
+        ///
+        /// @param  [in]  tHandle   Handle of the channel.
+        ///
+        /// @return whether the handle named a live channel
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Destroy(ChannelHandle tHandle);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::Clear
+        ///
+        /// Destroy every channel, invalidating all handles, as before loading a new recipe.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Clear(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::Get
+        ///
+        /// @param  [in]  tHandle   Handle of the channel.
+        ///
+        /// @return the channel, NULL when the handle is stale or was never valid
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        T * Get(ChannelHandle tHandle);
+
+        const T * Get(ChannelHandle tHandle) const { return const_cast<ChannelRegistry *>(this)->Get(tHandle); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::IsValid
+        ///
+        /// @return whether tHandle names a live channel
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool IsValid(ChannelHandle tHandle) const { return (Get(tHandle) != 0); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::GetChannels
+        ///
+        /// @return the live channels, GetCount() of them packed together in no particular order
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        T * GetChannels(void) { return reinterpret_cast<T *>(m_aubObjects); }
+
+        const T * GetChannels(void) const { return reinterpret_cast<const T *>(m_aubObjects); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::GetHandle
+        ///
+        /// @param  [in]  ulIndex   Position in GetChannels(), less than GetCount().
+        ///
+        /// @return handle of the channel at that position
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ChannelHandle GetHandle(uint32_t ulIndex) const
+        {
+            uint32_t ulSlot = m_auwSlotOfIndex[ulIndex];
+
+            return MakeHandle(ulSlot, m_auwGenerations[ulSlot]);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::GetCount
+        ///
+        /// @return number of live channels
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetCount(void) const { return m_ulCount; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        static_assert((CAPACITY != 0u) && (CAPACITY <= 0xFFFFu), "A registry holds 1 to 65535 channels");
+
+        // Handle fields
+        static const uint32_t GENERATION_SHIFT = 16u;
+        static const uint32_t SLOT_MASK = 0xFFFFu;
+
+        // Marks a slot with no channel in m_auwIndexOfSlot
+        static const uint16_t NO_INDEX = 0xFFFFu;
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::MakeHandle
+        ///
+        /// @return handle of a slot at a generation
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ChannelHandle MakeHandle(uint32_t ulSlot, uint32_t ulGeneration)
+        {
+            return (ulGeneration << GENERATION_SHIFT) | ulSlot;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ChannelRegistry::Release
+        ///
+        /// Return a slot to the free list, moving its generation on so its handles go stale.  Generation 0 is skipped
+        /// so no handle is ever INVALID_CHANNEL_HANDLE.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Release(uint32_t ulSlot)
+        {
+            uint16_t uwGeneration = static_cast<uint16_t>(m_auwGenerations[ulSlot] + 1u);
+
+            m_auwGenerations[ulSlot] = (uwGeneration != 0u) ? uwGeneration : 1u;
+            m_auwIndexOfSlot[ulSlot] = NO_INDEX;
+            m_auwFreeSlots[m_ulFreeCount++] = static_cast<uint16_t>(ulSlot);
+        }
+
+        // Inhibit copy constructor and assignment operator, handles name this registry's slots
+        ChannelRegistry(ChannelRegistry &);
+
+        ChannelRegistry & operator=(ChannelRegistry const&);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Storage of the channels, the first m_ulCount constructed
+        alignas(T) uint8_t m_aubObjects[CAPACITY * sizeof(T)];
+
+        // Position in the storage of the channel of each slot, NO_INDEX for a free slot
+        uint16_t m_auwIndexOfSlot[CAPACITY];
+
+        // Slot of the channel at each position in the storage
+        uint16_t m_auwSlotOfIndex[CAPACITY];
+
+        // Current generation of each slot
+        uint16_t m_auwGenerations[CAPACITY];
+
+        // Stack of free slots
+        uint16_t m_auwFreeSlots[CAPACITY];
+        uint32_t m_ulFreeCount;
+
+        // Live channels
+        uint32_t m_ulCount;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ChannelRegistry::ChannelRegistry
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T, uint32_t CAPACITY>
+ChannelRegistry<T, CAPACITY>::ChannelRegistry() : m_ulFreeCount(0), m_ulCount(0)
+{
+    // Pushed highest first so the first channels created take the lowest slots
+    for (uint32_t ulSlot = CAPACITY; ulSlot != 0u; --ulSlot)
+    {
+        m_auwGenerations[ulSlot - 1u] = 0u;
+
+        Release(ulSlot - 1u);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ChannelRegistry::Create
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T, uint32_t CAPACITY>
+template <typename... Args>
+ChannelHandle ChannelRegistry<T, CAPACITY>::Create(Args &&... rArgs)
+{
+    ChannelHandle tHandle = INVALID_CHANNEL_HANDLE;
+
+    if (m_ulFreeCount != 0u)
+    {
+        uint32_t ulSlot = m_auwFreeSlots[--m_ulFreeCount];
+
+        new (GetChannels() + m_ulCount) T(std::forward<Args>(rArgs)...);
+
+        m_auwIndexOfSlot[ulSlot] = static_cast<uint16_t>(m_ulCount);
+        m_auwSlotOfIndex[m_ulCount] = static_cast<uint16_t>(ulSlot);
+        ++m_ulCount;
+
+        tHandle = MakeHandle(ulSlot, m_auwGenerations[ulSlot]);
+    }
+
+    return tHandle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ChannelRegistry::Destroy
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T, uint32_t CAPACITY>
+bool ChannelRegistry<T, CAPACITY>::Destroy(ChannelHandle tHandle)
+{
+    T * pChannel = Get(tHandle);
+
+    if (pChannel != 0)
+    {
+        uint32_t ulSlot = tHandle & SLOT_MASK;
+        uint32_t ulLast = m_ulCount - 1u;
+        T *      pLast = GetChannels() + ulLast;
+
+        pChannel->~T();
+
+        //
+        // Keep the storage packed by moving the last channel into the hole, and point its slot at the new place.
+        //
+        if (pChannel != pLast)
+        {
+            uint32_t ulIndex = m_auwIndexOfSlot[ulSlot];
+            uint32_t ulLastSlot = m_auwSlotOfIndex[ulLast];
+
+            new (pChannel) T(std::move(*pLast));
+
+            pLast->~T();
+
+            m_auwIndexOfSlot[ulLastSlot] = static_cast<uint16_t>(ulIndex);
+            m_auwSlotOfIndex[ulIndex] = static_cast<uint16_t>(ulLastSlot);
+        }
+
+        m_ulCount = ulLast;
+
+        Release(ulSlot);
+    }
+
+    return (pChannel != 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ChannelRegistry::Clear
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T, uint32_t CAPACITY>
+void ChannelRegistry<T, CAPACITY>::Clear(void)
+{
+    while (m_ulCount != 0u)
+    {
+        --m_ulCount;
+
+        GetChannels()[m_ulCount].~T();
+
+        Release(m_auwSlotOfIndex[m_ulCount]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ChannelRegistry::Get
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename T, uint32_t CAPACITY>
+T * ChannelRegistry<T, CAPACITY>::Get(ChannelHandle tHandle)
+{
+    uint32_t ulSlot = tHandle & SLOT_MASK;
+    T *      pChannel = 0;
+
+    if ((ulSlot < CAPACITY) &&
+        (m_auwIndexOfSlot[ulSlot] != NO_INDEX) &&
+        ((tHandle >> GENERATION_SHIFT) == m_auwGenerations[ulSlot]))
+    {
+        pChannel = GetChannels() + m_auwIndexOfSlot[ulSlot];
+    }
+
+    return pChannel;
+}
+
+} // SignalChain
+#endif // #if !defined(CHANNEL_REGISTRY_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
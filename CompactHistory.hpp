@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file CompactHistory.hpp
+///
+/// Sample history stored in a 16 bit floating point format
+///
+/// @par Full Description
+/// Class header and implementation of the CompactHistory class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(COMPACT_HISTORY_HPP)
+#define COMPACT_HISTORY_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FloatLib.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    // Conversions of a storage format, specialized for App::Float16 and App::BFloat16
+    template <typename Format>
+    struct CompactFormat;
+
+    template <>
+    struct CompactFormat<App::Float16>
+    {
+        static App::Float16 Encode(float fValue) { return App::FloatToFloat16(fValue); }
+        static float Decode(App::Float16 tValue) { return App::Float16ToFloat(tValue); }
+
+        static void Encode(const float * pfInput, App::Float16 * ptOutput, uint32_t ulCount)
+        {
+            App::FloatToFloat16(pfInput, ptOutput, ulCount);
+        }
+
+        static void Decode(const App::Float16 * ptInput, float * pfOutput, uint32_t ulCount)
+        {
+            App::Float16ToFloat(ptInput, pfOutput, ulCount);
+        }
+    };
+
+    template <>
+    struct CompactFormat<App::BFloat16>
+    {
+        static App::BFloat16 Encode(float fValue) { return App::FloatToBFloat16(fValue); }
+        static float Decode(App::BFloat16 tValue) { return App::BFloat16ToFloat(tValue); }
+
+        static void Encode(const float * pfInput, App::BFloat16 * ptOutput, uint32_t ulCount)
+        {
+            App::FloatToBFloat16(pfInput, ptOutput, ulCount);
+        }
+
+        static void Decode(const App::BFloat16 * ptInput, float * pfOutput, uint32_t ulCount)
+        {
+            App::BFloat16ToFloat(ptInput, pfOutput, ulCount);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: CompactHistory
+    ///
+    /// Ring of the last CAPACITY samples of a signal, stored as App::Float16 or App::BFloat16
+    ///
+    /// @par Full Description
+    /// Samples are converted to the 16 bit format as they are pushed and back to float as they are read, so the
+    /// history takes half the memory of a float ring while the arithmetic on it stays in float.  CopyLatest decodes
+    /// a window of the history with the vectorized FloatLib array conversions, in at most two runs either side of
+    /// the wrap of the ring.
+    ///
+    /// The formats trade differently.  Float16 keeps 11 significant bits but only reaches 65504, larger magnitudes
+    /// are stored as infinite, and magnitudes below 2^-14 lose precision.  BFloat16 has the range of a float but
+    /// only 8 significant bits.  The choice is the caller's, by the signal's range and the resolution it needs.
+    /// Stored values can be classified with the App functions without decoding them.
+    ///
+    /// The rounding to 16 bits means a decoded sample is not the sample pushed, so this is meant for histories that
+    /// are displayed, trended or compared against limits, not for the running sums of LeastSquaresSlope, which would
+    /// drift as the rounded samples are removed.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Format, uint32_t CAPACITY>
+class CompactHistory
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::CompactHistory
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CompactHistory() : m_ulNext(0), m_ulStored(0) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::~CompactHistory
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CompactHistory() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::Push
+        ///
+        /// Add a sample, replacing the oldest once the history is full.
+        ///
+        /// @param  [in]  fValue   Sample.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Push(float fValue)
+        {
+            m_atValues[m_ulNext] = CompactFormat<Format>::Encode(fValue);
+            m_ulNext = (m_ulNext + 1u) & SLOT_MASK;
+            m_ulStored += (m_ulStored < CAPACITY) ? 1u : 0u;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::Push
+        ///
+        /// Add a block of samples, oldest first, with the vectorized conversion.
+        ///
+        /// @param  [in]  pfValues   Samples.
+        /// @param  [in]  ulCount    Number of samples, only the last CAPACITY are kept.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Push(const float * pfValues, uint32_t ulCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::Get
+        ///
+        /// @pre    ulAge is less than GetCount().
+        ///
+        /// @return the sample ulAge places older than the newest, decoded
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float Get(uint32_t ulAge) const { return CompactFormat<Format>::Decode(GetEncoded(ulAge)); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::GetEncoded
+        ///
+        /// @pre    ulAge is less than GetCount().
+        ///
+        /// @return the sample ulAge places older than the newest, as stored
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Format GetEncoded(uint32_t ulAge) const { return m_atValues[(m_ulNext - 1u - ulAge) & SLOT_MASK]; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::CopyLatest
+        ///
+        /// Decode the newest samples, oldest first.
+        ///
+        /// @param  [out] pfOutput   Decoded samples.
+        /// @param  [in]  ulCount    Capacity of pfOutput.
+        ///
+        /// @return number of samples written, the lesser of ulCount and GetCount()
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t CopyLatest(float * pfOutput, uint32_t ulCount) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::Reset
+        ///
+        /// Empty the history.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void)
+        {
+            m_ulNext = 0;
+            m_ulStored = 0;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CompactHistory::GetCount
+        ///
+        /// @return number of samples held, at most CAPACITY
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetCount(void) const { return m_ulStored; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        static_assert((CAPACITY != 0) && ((CAPACITY & (CAPACITY - 1)) == 0), "Capacity must be a power of two");
+        static_assert(sizeof(Format) == sizeof(uint16_t), "The storage format must be 16 bits");
+
+        // Mask from a free running index to a slot
+        static const uint32_t SLOT_MASK = CAPACITY - 1;
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Encoded samples
+        Format   m_atValues[CAPACITY];
+
+        // Slot the next sample goes in
+        uint32_t m_ulNext;
+
+        // Samples held, at most CAPACITY
+        uint32_t m_ulStored;
+
+        // Inhibit copy constructor and assignment operator
+        CompactHistory(CompactHistory &);
+
+        CompactHistory & operator=(CompactHistory const&); // assign op. hidden
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CompactHistory::Push
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename Format, uint32_t CAPACITY>
+void CompactHistory<Format, CAPACITY>::Push(const float * pfValues, uint32_t ulCount)
+{
+    // Samples that would be overwritten within the block are skipped
+    if (ulCount > CAPACITY)
+    {
+        pfValues += ulCount - CAPACITY;
+        ulCount = CAPACITY;
+    }
+
+    uint32_t ulFirstRun = ((CAPACITY - m_ulNext) < ulCount) ? (CAPACITY - m_ulNext) : ulCount;
+
+    CompactFormat<Format>::Encode(pfValues, m_atValues + m_ulNext, ulFirstRun);
+    CompactFormat<Format>::Encode(pfValues + ulFirstRun, m_atValues, ulCount - ulFirstRun);
+
+    m_ulNext = (m_ulNext + ulCount) & SLOT_MASK;
+    m_ulStored = ((CAPACITY - m_ulStored) < ulCount) ? CAPACITY : (m_ulStored + ulCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CompactHistory::CopyLatest
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename Format, uint32_t CAPACITY>
+uint32_t CompactHistory<Format, CAPACITY>::CopyLatest(float * pfOutput, uint32_t ulCount) const
+{
+    uint32_t ulCopied = (ulCount < m_ulStored) ? ulCount : m_ulStored;
+    uint32_t ulStart = (m_ulNext - ulCopied) & SLOT_MASK;
+    uint32_t ulFirstRun = ((CAPACITY - ulStart) < ulCopied) ? (CAPACITY - ulStart) : ulCopied;
+
+    CompactFormat<Format>::Decode(m_atValues + ulStart, pfOutput, ulFirstRun);
+    CompactFormat<Format>::Decode(m_atValues, pfOutput + ulFirstRun, ulCopied - ulFirstRun);
+
+    return ulCopied;
+}
+
+} // SignalChain
+#endif // #if !defined(COMPACT_HISTORY_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file FixedPeriodRateOfChange.cpp
+///
+/// Implementation of the FixedPeriodRateOfChange class
+///
+/// @see FixedPeriodRateOfChange.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FixedPeriodRateOfChange.hpp"
+#include "RateOfChangeKernel.hpp"
+
+namespace SignalChain
+{
+
+// FORWARD REFERENCES
+// (none)
+
+//**********************************************************************************************************************
+// Public methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FixedPeriodRateOfChange::FixedPeriodRateOfChange
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+FixedPeriodRateOfChange::FixedPeriodRateOfChange(uint32_t ulPeriodUs, uint32_t ulToleranceUs)
+    : m_bInitialCall(true),
+      m_fPreviousValue(0.0f),
+      m_ulPreviousTimestampUs(0),
+      m_ulPeriodUs((ulPeriodUs != 0u) ? ulPeriodUs : 1u),
+      m_ulToleranceUs(0),
+      m_fInversePeriodUs(0.0f),
+      m_ulOffPeriodCount(0)
+{
+    // Below the period, and small enough that twice it, the width of the accepted range, cannot overflow
+    uint32_t ulLargestToleranceUs = (m_ulPeriodUs <= 0x80000000u) ? (m_ulPeriodUs - 1u) : 0x7FFFFFFFu;
+
+    m_ulToleranceUs = (ulToleranceUs < ulLargestToleranceUs) ? ulToleranceUs : ulLargestToleranceUs;
+
+    // Rounded once from double, the nearest float to the true reciprocal
+    m_fInversePeriodUs = static_cast<float>(1.0 / static_cast<double>(m_ulPeriodUs));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FixedPeriodRateOfChange::CalcRateOfChangeUs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void FixedPeriodRateOfChange::CalcRateOfChangeUs(const float *    pfCurrentValues,
+                                                 const uint32_t * pulCurrentTimestampsUs,
+                                                 float *          pfRates,
+                                                 uint32_t         ulCount)
+{
+    if (ulCount != 0)
+    {
+        //
+        // The first sample depends on the state left by the previous call, including the initial call case, so it
+        // goes through the streaming path.
+        //
+        pfRates[0] = CalcRateOfChangeUs(pfCurrentValues[0], pulCurrentTimestampsUs[0]);
+
+        //
+        // Every later sample is differenced against its neighbour in the same buffer.
+        //
+        AddOffPeriod(Kernel::CalcFixedPeriodRatesUs(&pfCurrentValues[1], &pfCurrentValues[0],
+                                                    &pulCurrentTimestampsUs[1], &pulCurrentTimestampsUs[0],
+                                                    m_ulPeriodUs, m_ulToleranceUs, m_fInversePeriodUs,
+                                                    &pfRates[1], ulCount - 1));
+
+        m_ulPreviousTimestampUs = pulCurrentTimestampsUs[ulCount - 1];
+
+        m_fPreviousValue = pfCurrentValues[ulCount - 1];
+    }
+}
+
+} // SignalChain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
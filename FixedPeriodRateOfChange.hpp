@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file FixedPeriodRateOfChange.hpp
+///
+/// For computing rates of change of samples taken on a fixed period
+///
+/// @par Full Description
+/// Class header for the FixedPeriodRateOfChange class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(FIXED_PERIOD_RATE_OF_CHANGE_HPP)
+#define FIXED_PERIOD_RATE_OF_CHANGE_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FloatLib.hpp"
+#include "RateOfChange.hpp"
+#include "TimeBase.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: FixedPeriodRateOfChange
+    ///
+    /// For calculating rates of change of a channel sampled on a hardware timer
+    ///
+    /// @par Full Description
+    /// The reciprocal of the sample period is calculated once, at construction, so a sample whose timestamp is one
+    /// period after the previous one, within a tolerance, costs a subtract and a multiply instead of a division.
+    /// The timestamps are still checked on every sample: one further than the tolerance from the period, including
+    /// a repeated timestamp or a missed sample, goes through the exact calculation of RateOfChange and is counted,
+    /// so a timer that stops keeping time shows up in GetOffPeriodCount rather than as wrong rates.
+    ///
+    /// A rate within tolerance takes the elapsed time to be exactly the period, so it differs from the exact rate
+    /// by up to ulToleranceUs / ulPeriodUs relative, plus the rounding of the reciprocal.  A tolerance of 0 only
+    /// accepts exact periods, for which the rate is within a few ulps of RateOfChange.
+    ///
+    /// Timestamps are 32 bit microseconds, and the initial call returns 0 as RateOfChange does.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class FixedPeriodRateOfChange
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::FixedPeriodRateOfChange
+        ///
+        /// Constructor
+        ///
+        /// @param  [in]  ulPeriodUs      Sample period in microseconds, 0 is taken as 1.
+        /// @param  [in]  ulToleranceUs   Largest difference of an elapsed time from the period that is still taken as
+        ///                               the period, limited to less than the period so a repeated timestamp is
+        ///                               never accepted.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FixedPeriodRateOfChange(uint32_t ulPeriodUs, uint32_t ulToleranceUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::~FixedPeriodRateOfChange
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~FixedPeriodRateOfChange() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::CalcRateOfChange
+        ///
+        /// Calculate the rate of change between the previous value and the current value in units per RateUnit.
+        ///
+        /// @param  [in]  fCurrentValue          Current value.
+        /// @param  [in]  ulCurrentTimestampUs   Current timestamp in microseconds.
+        ///
+        /// @return Calculated rate of change in units per RateUnit
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename RateUnit>
+        float CalcRateOfChange(float fCurrentValue, uint32_t ulCurrentTimestampUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::CalcRateOfChangeUs
+        ///
+        /// CalcRateOfChange in units per microsecond.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float CalcRateOfChangeUs(float fCurrentValue, uint32_t ulCurrentTimestampUs)
+        {
+            return CalcRateOfChange<RateUnitUs>(fCurrentValue, ulCurrentTimestampUs);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::CalcRateOfChangeMs
+        ///
+        /// CalcRateOfChange in units per millisecond.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float CalcRateOfChangeMs(float fCurrentValue, uint32_t ulCurrentTimestampUs)
+        {
+            return CalcRateOfChange<RateUnitMs>(fCurrentValue, ulCurrentTimestampUs);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::CalcRateOfChangeSec
+        ///
+        /// CalcRateOfChange in units per second.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float CalcRateOfChangeSec(float fCurrentValue, uint32_t ulCurrentTimestampUs)
+        {
+            return CalcRateOfChange<RateUnitSec>(fCurrentValue, ulCurrentTimestampUs);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::CalcRateOfChangeUs
+        ///
+        /// Calculate the rate of change of every sample in a buffer in units per microsecond.
+        ///
+        /// @par Full Description
+        /// Batch form of CalcRateOfChangeUs, giving the same rates.  Sample i is differenced against sample i - 1,
+        /// and the first sample against the sample left by the previous call.  Everything after the first sample runs
+        /// through Kernel::CalcFixedPeriodRatesUs.
+        ///
+        /// @pre    pfRates does not overlap pfCurrentValues or pulCurrentTimestampsUs.
+        /// @post   Rates of change calculated and the last sample stored as the previous one.
+        ///
+        /// @param  [in]  pfCurrentValues          Values.
+        /// @param  [in]  pulCurrentTimestampsUs   Timestamps in microseconds.
+        /// @param  [out] pfRates                  Calculated rates of change in units per microsecond.
+        /// @param  [in]  ulCount                  Number of samples in each buffer.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CalcRateOfChangeUs(const float *    pfCurrentValues,
+                                const uint32_t * pulCurrentTimestampsUs,
+                                float *          pfRates,
+                                uint32_t         ulCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::GetOffPeriodCount
+        ///
+        /// @return samples whose elapsed time was out of tolerance since construction or the last clear, saturating
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetOffPeriodCount(void) const { return m_ulOffPeriodCount; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::ClearOffPeriodCount
+        ///
+        /// Restart the count of samples out of tolerance.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void ClearOffPeriodCount(void) { m_ulOffPeriodCount = 0; }
+
+    private:
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: FixedPeriodRateOfChange::AddOffPeriod
+        ///
+        /// Add to the count of samples out of tolerance, saturating.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void AddOffPeriod(uint32_t ulCount)
+        {
+            m_ulOffPeriodCount = ((UINT32_MAX - m_ulOffPeriodCount) < ulCount) ? UINT32_MAX :
+                                 (m_ulOffPeriodCount + ulCount);
+        }
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Initial call flag
+        bool     m_bInitialCall;
+
+        // Previous sample
+        float    m_fPreviousValue;
+        uint32_t m_ulPreviousTimestampUs;
+
+        // Sample period, tolerance and the reciprocal of the period
+        uint32_t m_ulPeriodUs;
+        uint32_t m_ulToleranceUs;
+        float    m_fInversePeriodUs;
+
+        // Samples out of tolerance
+        uint32_t m_ulOffPeriodCount;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FixedPeriodRateOfChange::CalcRateOfChange
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename RateUnit>
+inline float FixedPeriodRateOfChange::CalcRateOfChange(float fCurrentValue, uint32_t ulCurrentTimestampUs)
+{
+    // Same constant as BasicRateOfChange for the exact path, and its inverse, a whole number, for the fast path
+    constexpr float UNITS_PER_TICK = static_cast<float>(static_cast<double>(RateUnit::UNITS_PER_SECOND) /
+                                                        static_cast<double>(TimeBaseUs32::TICKS_PER_SECOND));
+    constexpr float TICKS_PER_UNIT = static_cast<float>(static_cast<double>(TimeBaseUs32::TICKS_PER_SECOND) /
+                                                        static_cast<double>(RateUnit::UNITS_PER_SECOND));
+
+    float fRateOfChange = 0.0f;
+
+    if (m_bInitialCall)
+    {
+        m_bInitialCall = false;
+    }
+    else
+    {
+        uint32_t ulDifference = TimeBaseUs32::Elapsed(ulCurrentTimestampUs, m_ulPreviousTimestampUs);
+
+        // Unsigned, so an elapsed time shorter than the period less the tolerance wraps to a large offset
+        if ((ulDifference - (m_ulPeriodUs - m_ulToleranceUs)) <= (2u * m_ulToleranceUs))
+        {
+            fRateOfChange = ((fCurrentValue - m_fPreviousValue) * m_fInversePeriodUs) * TICKS_PER_UNIT;
+        }
+        else
+        {
+            fRateOfChange = App::FLOAT_INFINITY;
+
+            if (ulDifference != 0)
+            {
+                fRateOfChange = (fCurrentValue - m_fPreviousValue) /
+                                (static_cast<float>(ulDifference) * UNITS_PER_TICK);
+            }
+
+            AddOffPeriod(1u);
+        }
+    }
+
+    m_ulPreviousTimestampUs = ulCurrentTimestampUs;
+
+    m_fPreviousValue = fCurrentValue;
+
+    return fRateOfChange;
+}
+
+} // SignalChain
+#endif // #if !defined(FIXED_PERIOD_RATE_OF_CHANGE_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
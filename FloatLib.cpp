@@ -1,12 +1,16 @@
 /////////////////////////////////////////////////////////////////////////////
 /// @file FloatLib.cpp
 ///
-/// This file contains the definitions of functions for working with floating point numbers
+/// This file contains the definitions of the array functions for working with floating point numbers.  The scalar
+/// functions are inline in FloatLib.hpp.
 ///
 ///
 /// @if REVISION_HISTORY_INCLUDED
 /// @par Edit History
 /// jmccaff 6-Apr-2016 initial implementation
+/// agent 16-Oct-2026 Added array classification kernels with run time CPU dispatch
+/// agent 16-Oct-2026 Scalar functions moved inline into FloatLib.hpp
+/// agent 16-Oct-2026 Added Float16 and BFloat16 array conversions
 /// @endif
 ///
 /// @ingroup FloatLib
@@ -15,7 +19,13 @@
 /////////////////////////////////////////////////////////////////////////////
 
 // SYSTEM INCLUDES
-// (none)
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#define FLOATLIB_AVX2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define FLOATLIB_NEON
+#endif
 
 // C PROJECT INCLUDES
 // (none)
@@ -27,95 +37,650 @@
 namespace App
 {
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-///@begin_claim_coding_exception
+//**********************************************************************************************************************
+// Array kernels
+//**********************************************************************************************************************
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: AccumulateScanMask
+//
+/// Adds one vector's worth of lane matches for a FloatType to a scan result.
+/// Bit n of ulLaneMask is set when element ulBaseIndex + n matched.
 ///
-/// Rule 3-9-3
-/// The underlying bit representations must be used to determine the classification of floating point values
+/////////////////////////////////////////////////////////////////////////////
+inline void AccumulateScanMask(FloatScanResult & rResult, FloatType eType, uint32_t ulLaneMask, uint32_t ulBaseIndex)
+{
+    if (ulLaneMask != 0)
+    {
+        if (rResult.aulCount[eType] == 0)
+        {
+            rResult.aulFirstIndex[eType] = ulBaseIndex + static_cast<uint32_t>(__builtin_ctz(ulLaneMask));
+        }
+        rResult.aulCount[eType] += static_cast<uint32_t>(__builtin_popcount(ulLaneMask));
+    }
+}
+
+#if defined(FLOATLIB_AVX2)
+
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: IsAvx2Supported
+//
+/// Run time check for AVX2, answered at compile time when the whole build
+/// already targets AVX2.
 ///
-//@end_claim_coding_exception
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-///@begin_code_exception
-  
 /////////////////////////////////////////////////////////////////////////////
-// METHOD NAME: FloatLib::FpClassify
+inline bool IsAvx2Supported(void)
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    static const bool bSupported = (__builtin_cpu_supports("avx2") != 0);
+    return bSupported;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: ClassifyMasksAvx2
 //
-/// Returns the type of the input float 
+/// Integer mask compares of eight floats, one all ones lane per match.
+/// Lanes matching none of the masks are normal.
 ///
 /////////////////////////////////////////////////////////////////////////////
-FloatType FpClassify(float fInput) 
+__attribute__((target("avx2")))
+inline void ClassifyMasksAvx2(const float * pfInput,
+                              __m256i &     rvInfinite,
+                              __m256i &     rvNan,
+                              __m256i &     rvSubnormal,
+                              __m256i &     rvZero)
+{
+    __m256i vMagnitude = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(pfInput)),
+                                          _mm256_set1_epi32(static_cast<int32_t>(FLOAT_MAGNITUDE_MASK)));
+    __m256i vInfiniteBits = _mm256_set1_epi32(static_cast<int32_t>(FLOAT_INFINITE_BITS));
+
+    // The magnitude never has the sign bit set so signed compares are safe
+    rvZero      = _mm256_cmpeq_epi32(vMagnitude, _mm256_setzero_si256());
+    rvInfinite  = _mm256_cmpeq_epi32(vMagnitude, vInfiniteBits);
+    rvNan       = _mm256_cmpgt_epi32(vMagnitude, vInfiniteBits);
+    rvSubnormal = _mm256_andnot_si256(rvZero,
+                                      _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(FLOAT_MIN_NORMAL_BITS)),
+                                                         vMagnitude));
+}
+
+__attribute__((target("avx2")))
+inline uint32_t LaneMaskAvx2(__m256i vMask)
 {
-    // Float exponent bit mask
-    static const uint32_t FLOAT_EXPONENT       = 0x7F800000U;
-    // Float mantissa bit mask
-    static const uint32_t FLOAT_MANTISSA       = 0x007FFFFFU;
-    // Zero mantissa
-    static const uint32_t FLOAT_ZERO_MANTISSA  =        0x0U;
-    // Zero float
-    static const uint32_t FLOAT_ZERO           =        0x0U;
-    // Negative zero float
-    static const uint32_t FLOAT_NEGATIVE_ZERO  = 0x80000000U;
-    // Float zero exponent
-    static const uint32_t FLOAT_ZERO_EXPONENT  =        0x0U; 
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(vMask)));
+}
 
-    uint32_t ulFloatAsBits = reinterpret_cast<uint32_t&>(fInput);
-    FloatType eFloatType;
-    //Check for zero
-    if(ulFloatAsBits == FLOAT_ZERO || ulFloatAsBits == FLOAT_NEGATIVE_ZERO)
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: ClassifyAvx2
+//
+/// Classifies whole vectors of the array and returns the number of elements
+/// done, the remainder is left for the scalar loop.
+///
+/////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2")))
+uint32_t ClassifyAvx2(const float * pfInput, uint8_t * pubTypes, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        __m256i vInfinite, vNan, vSubnormal, vZero;
+        ClassifyMasksAvx2(pfInput + ulIndex, vInfinite, vNan, vSubnormal, vZero);
+
+        __m256i vType = _mm256_set1_epi32(FLP_NORMAL);
+        vType = _mm256_blendv_epi8(vType, _mm256_set1_epi32(FLP_INFINITE), vInfinite);
+        vType = _mm256_blendv_epi8(vType, _mm256_set1_epi32(FLP_NAN), vNan);
+        vType = _mm256_blendv_epi8(vType, _mm256_set1_epi32(FLP_SUBNORMAL), vSubnormal);
+        vType = _mm256_blendv_epi8(vType, _mm256_set1_epi32(FLP_ZERO), vZero);
+
+        // Narrow the eight 32 bit types to bytes
+        __m128i vWords = _mm_packs_epi32(_mm256_castsi256_si128(vType), _mm256_extracti128_si256(vType, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(pubTypes + ulIndex), _mm_packus_epi16(vWords, vWords));
+    }
+
+    return ulIndex;
+}
+
+__attribute__((target("avx2,popcnt")))
+uint32_t ScanAvx2(const float * pfInput, uint32_t ulCount, FloatScanResult & rResult)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
     {
-        eFloatType = FLP_ZERO;
+        __m256i vInfinite, vNan, vSubnormal, vZero;
+        ClassifyMasksAvx2(pfInput + ulIndex, vInfinite, vNan, vSubnormal, vZero);
+
+        uint32_t ulInfinite  = LaneMaskAvx2(vInfinite);
+        uint32_t ulNan       = LaneMaskAvx2(vNan);
+        uint32_t ulSubnormal = LaneMaskAvx2(vSubnormal);
+        uint32_t ulZero      = LaneMaskAvx2(vZero);
+        uint32_t ulNormal    = ~(ulInfinite | ulNan | ulSubnormal | ulZero) & 0xFFU;
+
+        AccumulateScanMask(rResult, FLP_INFINITE, ulInfinite, ulIndex);
+        AccumulateScanMask(rResult, FLP_NAN, ulNan, ulIndex);
+        AccumulateScanMask(rResult, FLP_NORMAL, ulNormal, ulIndex);
+        AccumulateScanMask(rResult, FLP_SUBNORMAL, ulSubnormal, ulIndex);
+        AccumulateScanMask(rResult, FLP_ZERO, ulZero, ulIndex);
     }
-    //INF and NAN have all 1's in exponent
-    else if((ulFloatAsBits & FLOAT_EXPONENT) == FLOAT_EXPONENT)
+
+    return ulIndex;
+}
+
+__attribute__((target("avx2")))
+uint32_t FindFirstAvx2(const float * pfInput, uint32_t ulCount, uint32_t ulTypeMask, bool & rbFound)
+{
+    const __m256i vAllOnes = _mm256_set1_epi32(-1);
+    // Normal lanes are the ones no other mask selects
+    const bool bSelectNormal = ((ulTypeMask & FLP_MASK_NORMAL) != 0);
+    const __m256i vSelectInfinite  = _mm256_set1_epi32(((ulTypeMask & FLP_MASK_INFINITE) != 0) ? -1 : 0);
+    const __m256i vSelectNan       = _mm256_set1_epi32(((ulTypeMask & FLP_MASK_NAN) != 0) ? -1 : 0);
+    const __m256i vSelectSubnormal = _mm256_set1_epi32(((ulTypeMask & FLP_MASK_SUBNORMAL) != 0) ? -1 : 0);
+    const __m256i vSelectZero      = _mm256_set1_epi32(((ulTypeMask & FLP_MASK_ZERO) != 0) ? -1 : 0);
+
+    uint32_t ulIndex = 0;
+    rbFound = false;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
     {
-        //INF has all 0's in mantissa
-        if((ulFloatAsBits & FLOAT_MANTISSA) == FLOAT_ZERO_MANTISSA)
+        __m256i vInfinite, vNan, vSubnormal, vZero;
+        ClassifyMasksAvx2(pfInput + ulIndex, vInfinite, vNan, vSubnormal, vZero);
+
+        __m256i vNotNormal = _mm256_or_si256(_mm256_or_si256(vInfinite, vNan), _mm256_or_si256(vSubnormal, vZero));
+        __m256i vMatch = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(vInfinite, vSelectInfinite),
+                                                         _mm256_and_si256(vNan, vSelectNan)),
+                                         _mm256_or_si256(_mm256_and_si256(vSubnormal, vSelectSubnormal),
+                                                         _mm256_and_si256(vZero, vSelectZero)));
+        if (bSelectNormal)
         {
-            eFloatType = FLP_INFINITE;
+            vMatch = _mm256_or_si256(vMatch, _mm256_xor_si256(vNotNormal, vAllOnes));
         }
-        else
+
+        uint32_t ulLaneMask = LaneMaskAvx2(vMatch);
+        if (ulLaneMask != 0)
+        {
+            rbFound = true;
+            ulIndex += static_cast<uint32_t>(__builtin_ctz(ulLaneMask));
+            break;
+        }
+    }
+
+    return ulIndex;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: IsF16cSupported
+//
+/// Run time check for the F16C half precision conversions, answered at
+/// compile time when the whole build already targets F16C.
+///
+/////////////////////////////////////////////////////////////////////////////
+inline bool IsF16cSupported(void)
+{
+#if defined(__F16C__)
+    return true;
+#else
+    static const bool bSupported = (__builtin_cpu_supports("avx") != 0) && (__builtin_cpu_supports("f16c") != 0);
+    return bSupported;
+#endif
+}
+
+__attribute__((target("avx,f16c")))
+uint32_t FloatToFloat16F16c(const float * pfInput, Float16 * ptOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptOutput + ulIndex),
+                         _mm256_cvtps_ph(_mm256_loadu_ps(pfInput + ulIndex), _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    return ulIndex;
+}
+
+__attribute__((target("avx,f16c")))
+uint32_t Float16ToFloatF16c(const Float16 * ptInput, float * pfOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        _mm256_storeu_ps(pfOutput + ulIndex,
+                         _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptInput + ulIndex))));
+    }
+
+    return ulIndex;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: FloatToBFloat16Avx2
+//
+/// The scalar rounding of FloatToBFloat16 on eight floats at a time, with
+/// NaN lanes blended in afterwards.
+///
+/////////////////////////////////////////////////////////////////////////////
+__attribute__((target("avx2")))
+uint32_t FloatToBFloat16Avx2(const float * pfInput, BFloat16 * ptOutput, uint32_t ulCount)
+{
+    const __m256i vOne           = _mm256_set1_epi32(1);
+    const __m256i vRoundingBias  = _mm256_set1_epi32(0x7FFF);
+    const __m256i vQuietBit      = _mm256_set1_epi32(0x0040);
+    const __m256i vMagnitudeMask = _mm256_set1_epi32(static_cast<int32_t>(FLOAT_MAGNITUDE_MASK));
+    const __m256i vInfiniteBits  = _mm256_set1_epi32(static_cast<int32_t>(FLOAT_INFINITE_BITS));
+
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        __m256i vBits  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pfInput + ulIndex));
+        __m256i vUpper = _mm256_srli_epi32(vBits, 16);
+        __m256i vNan   = _mm256_cmpgt_epi32(_mm256_and_si256(vBits, vMagnitudeMask), vInfiniteBits);
+
+        __m256i vRounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(vBits, vRoundingBias),
+                                                              _mm256_and_si256(vUpper, vOne)), 16);
+        __m256i vResult  = _mm256_blendv_epi8(vRounded, _mm256_or_si256(vUpper, vQuietBit), vNan);
+
+        // Every lane is below 0x10000, so the unsigned saturating pack keeps it unchanged
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptOutput + ulIndex),
+                         _mm_packus_epi32(_mm256_castsi256_si128(vResult), _mm256_extracti128_si256(vResult, 1)));
+    }
+
+    return ulIndex;
+}
+
+__attribute__((target("avx2")))
+uint32_t BFloat16ToFloatAvx2(const BFloat16 * ptInput, float * pfOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        __m256i vWide = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptInput + ulIndex)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(pfOutput + ulIndex), _mm256_slli_epi32(vWide, 16));
+    }
+
+    return ulIndex;
+}
+
+#elif defined(FLOATLIB_NEON)
+
+/////////////////////////////////////////////////////////////////////////////
+// FUNCTION NAME: ClassifyMasksNeon
+//
+/// Integer mask compares of four floats, one all ones lane per match.
+/// Lanes matching none of the masks are normal.
+///
+/////////////////////////////////////////////////////////////////////////////
+inline void ClassifyMasksNeon(const float * pfInput,
+                              uint32x4_t &  rvInfinite,
+                              uint32x4_t &  rvNan,
+                              uint32x4_t &  rvSubnormal,
+                              uint32x4_t &  rvZero)
+{
+    uint32x4_t vMagnitude = vandq_u32(vreinterpretq_u32_f32(vld1q_f32(pfInput)), vdupq_n_u32(FLOAT_MAGNITUDE_MASK));
+
+    rvZero      = vceqzq_u32(vMagnitude);
+    rvInfinite  = vceqq_u32(vMagnitude, vdupq_n_u32(FLOAT_INFINITE_BITS));
+    rvNan       = vcgtq_u32(vMagnitude, vdupq_n_u32(FLOAT_INFINITE_BITS));
+    rvSubnormal = vbicq_u32(vcltq_u32(vMagnitude, vdupq_n_u32(FLOAT_MIN_NORMAL_BITS)), rvZero);
+}
+
+inline uint32_t LaneMaskNeon(uint32x4_t vMask)
+{
+    static const uint32_t aulLaneBits[4] = { 1U, 2U, 4U, 8U };
+    return vaddvq_u32(vandq_u32(vMask, vld1q_u32(aulLaneBits)));
+}
+
+inline uint32x4_t SelectTypeNeon(uint32x4_t vInfinite, uint32x4_t vNan, uint32x4_t vSubnormal, uint32x4_t vZero)
+{
+    uint32x4_t vType = vdupq_n_u32(FLP_NORMAL);
+    vType = vbslq_u32(vInfinite, vdupq_n_u32(FLP_INFINITE), vType);
+    vType = vbslq_u32(vNan, vdupq_n_u32(FLP_NAN), vType);
+    vType = vbslq_u32(vSubnormal, vdupq_n_u32(FLP_SUBNORMAL), vType);
+    return vbslq_u32(vZero, vdupq_n_u32(FLP_ZERO), vType);
+}
+
+uint32_t ClassifyNeon(const float * pfInput, uint8_t * pubTypes, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        uint32x4_t vInfinite, vNan, vSubnormal, vZero;
+
+        ClassifyMasksNeon(pfInput + ulIndex, vInfinite, vNan, vSubnormal, vZero);
+        uint16x4_t vLow = vmovn_u32(SelectTypeNeon(vInfinite, vNan, vSubnormal, vZero));
+
+        ClassifyMasksNeon(pfInput + ulIndex + 4, vInfinite, vNan, vSubnormal, vZero);
+        uint16x4_t vHigh = vmovn_u32(SelectTypeNeon(vInfinite, vNan, vSubnormal, vZero));
+
+        vst1_u8(pubTypes + ulIndex, vmovn_u16(vcombine_u16(vLow, vHigh)));
+    }
+
+    return ulIndex;
+}
+
+uint32_t ScanNeon(const float * pfInput, uint32_t ulCount, FloatScanResult & rResult)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        uint32x4_t vInfinite, vNan, vSubnormal, vZero;
+        ClassifyMasksNeon(pfInput + ulIndex, vInfinite, vNan, vSubnormal, vZero);
+
+        uint32_t ulInfinite  = LaneMaskNeon(vInfinite);
+        uint32_t ulNan       = LaneMaskNeon(vNan);
+        uint32_t ulSubnormal = LaneMaskNeon(vSubnormal);
+        uint32_t ulZero      = LaneMaskNeon(vZero);
+        uint32_t ulNormal    = ~(ulInfinite | ulNan | ulSubnormal | ulZero) & 0xFU;
+
+        AccumulateScanMask(rResult, FLP_INFINITE, ulInfinite, ulIndex);
+        AccumulateScanMask(rResult, FLP_NAN, ulNan, ulIndex);
+        AccumulateScanMask(rResult, FLP_NORMAL, ulNormal, ulIndex);
+        AccumulateScanMask(rResult, FLP_SUBNORMAL, ulSubnormal, ulIndex);
+        AccumulateScanMask(rResult, FLP_ZERO, ulZero, ulIndex);
+    }
+
+    return ulIndex;
+}
+
+uint32_t FindFirstNeon(const float * pfInput, uint32_t ulCount, uint32_t ulTypeMask, bool & rbFound)
+{
+    uint32_t ulIndex = 0;
+    rbFound = false;
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        uint32x4_t vInfinite, vNan, vSubnormal, vZero;
+        ClassifyMasksNeon(pfInput + ulIndex, vInfinite, vNan, vSubnormal, vZero);
+
+        uint32_t ulInfinite  = LaneMaskNeon(vInfinite);
+        uint32_t ulNan       = LaneMaskNeon(vNan);
+        uint32_t ulSubnormal = LaneMaskNeon(vSubnormal);
+        uint32_t ulZero      = LaneMaskNeon(vZero);
+        uint32_t ulNormal    = ~(ulInfinite | ulNan | ulSubnormal | ulZero) & 0xFU;
+
+        uint32_t ulLaneMask = (((ulTypeMask & FLP_MASK_INFINITE) != 0)  ? ulInfinite  : 0U) |
+                              (((ulTypeMask & FLP_MASK_NAN) != 0)       ? ulNan       : 0U) |
+                              (((ulTypeMask & FLP_MASK_NORMAL) != 0)    ? ulNormal    : 0U) |
+                              (((ulTypeMask & FLP_MASK_SUBNORMAL) != 0) ? ulSubnormal : 0U) |
+                              (((ulTypeMask & FLP_MASK_ZERO) != 0)      ? ulZero      : 0U);
+        if (ulLaneMask != 0)
         {
-            eFloatType = FLP_NAN;
+            rbFound = true;
+            ulIndex += static_cast<uint32_t>(__builtin_ctz(ulLaneMask));
+            break;
         }
     }
-    else
+
+    return ulIndex;
+}
+
+uint32_t FloatToFloat16Neon(const float * pfInput, Float16 * ptOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        vst1_u16(reinterpret_cast<uint16_t *>(ptOutput + ulIndex),
+                 vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(pfInput + ulIndex))));
+    }
+
+    return ulIndex;
+}
+
+uint32_t Float16ToFloatNeon(const Float16 * ptInput, float * pfOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
     {
-        //Subnormal has all 0's in exponent
-        if((ulFloatAsBits & FLOAT_EXPONENT) == FLOAT_ZERO_EXPONENT)
+        vst1q_f32(pfOutput + ulIndex,
+                  vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptInput + ulIndex)))));
+    }
+
+    return ulIndex;
+}
+
+uint32_t FloatToBFloat16Neon(const float * pfInput, BFloat16 * ptOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        uint32x4_t vBits  = vreinterpretq_u32_f32(vld1q_f32(pfInput + ulIndex));
+        uint32x4_t vUpper = vshrq_n_u32(vBits, 16);
+        uint32x4_t vNan   = vcgtq_u32(vandq_u32(vBits, vdupq_n_u32(FLOAT_MAGNITUDE_MASK)),
+                                      vdupq_n_u32(FLOAT_INFINITE_BITS));
+
+        uint32x4_t vRounded = vaddq_u32(vaddq_u32(vBits, vdupq_n_u32(0x7FFFU)), vandq_u32(vUpper, vdupq_n_u32(1U)));
+        uint16x4_t vResult  = vbsl_u16(vmovn_u32(vNan),
+                                       vorr_u16(vmovn_u32(vUpper), vdup_n_u16(0x0040U)),
+                                       vshrn_n_u32(vRounded, 16));
+
+        vst1_u16(reinterpret_cast<uint16_t *>(ptOutput + ulIndex), vResult);
+    }
+
+    return ulIndex;
+}
+
+uint32_t BFloat16ToFloatNeon(const BFloat16 * ptInput, float * pfOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        uint32x4_t vWide = vshll_n_u16(vld1_u16(reinterpret_cast<const uint16_t *>(ptInput + ulIndex)), 16);
+        vst1q_f32(pfOutput + ulIndex, vreinterpretq_f32_u32(vWide));
+    }
+
+    return ulIndex;
+}
+
+#endif
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////
+// METHOD NAME: FloatLib::FpClassify
+//
+/// Classifies every float in an array
+///
+/////////////////////////////////////////////////////////////////////////////
+void FpClassify(const float * pfInput, uint8_t * pubTypes, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+#if defined(FLOATLIB_AVX2)
+    if (IsAvx2Supported())
+    {
+        ulIndex = ClassifyAvx2(pfInput, pubTypes, ulCount);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = ClassifyNeon(pfInput, pubTypes, ulCount);
+#endif
+
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        pubTypes[ulIndex] = static_cast<uint8_t>(FpClassify(pfInput[ulIndex]));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// METHOD NAME: FloatLib::FpScan
+//
+/// Counts and finds the first float of each type in an array
+///
+/////////////////////////////////////////////////////////////////////////////
+void FpScan(const float * pfInput, uint32_t ulCount, FloatScanResult & rResult)
+{
+    uint32_t ulIndex = 0;
+
+    for (uint32_t ulType = 0; ulType < FLP_TYPE_COUNT; ++ulType)
+    {
+        rResult.aulCount[ulType] = 0;
+        rResult.aulFirstIndex[ulType] = ulCount;
+    }
+
+#if defined(FLOATLIB_AVX2)
+    if (IsAvx2Supported())
+    {
+        ulIndex = ScanAvx2(pfInput, ulCount, rResult);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = ScanNeon(pfInput, ulCount, rResult);
+#endif
+
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        FloatType eFloatType = FpClassify(pfInput[ulIndex]);
+
+        AccumulateScanMask(rResult, eFloatType, 1U, ulIndex);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// METHOD NAME: FloatLib::FpFindFirst
+//
+/// Returns the index of the first float of a selected type in an array
+///
+/////////////////////////////////////////////////////////////////////////////
+uint32_t FpFindFirst(const float * pfInput, uint32_t ulCount, uint32_t ulTypeMask)
+{
+    uint32_t ulIndex = 0;
+    bool     bFound = false;
+
+#if defined(FLOATLIB_AVX2)
+    if (IsAvx2Supported())
+    {
+        ulIndex = FindFirstAvx2(pfInput, ulCount, ulTypeMask, bFound);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = FindFirstNeon(pfInput, ulCount, ulTypeMask, bFound);
+#endif
+
+    while (!bFound && (ulIndex < ulCount))
+    {
+        if (((1U << FpClassify(pfInput[ulIndex])) & ulTypeMask) != 0)
         {
-            eFloatType = FLP_SUBNORMAL;
+            bFound = true;
         }
         else
         {
-            eFloatType = FLP_NORMAL;
+            ++ulIndex;
         }
     }
-    return eFloatType;
-} 
-//@end_code_exception    
+
+    return bFound ? ulIndex : ulCount;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// METHOD NAME: FloatLib::FloatToFloat16
+//
+/// Converts every float in an array to a Float16
+///
+/////////////////////////////////////////////////////////////////////////////
+void FloatToFloat16(const float * pfInput, Float16 * ptOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+#if defined(FLOATLIB_AVX2)
+    if (IsF16cSupported())
+    {
+        ulIndex = FloatToFloat16F16c(pfInput, ptOutput, ulCount);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = FloatToFloat16Neon(pfInput, ptOutput, ulCount);
+#endif
+
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        ptOutput[ulIndex] = FloatToFloat16(pfInput[ulIndex]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// METHOD NAME: FloatLib::Float16ToFloat
+//
+/// Converts every Float16 in an array to a float
+///
+/////////////////////////////////////////////////////////////////////////////
+void Float16ToFloat(const Float16 * ptInput, float * pfOutput, uint32_t ulCount)
+{
+    uint32_t ulIndex = 0;
+
+#if defined(FLOATLIB_AVX2)
+    if (IsF16cSupported())
+    {
+        ulIndex = Float16ToFloatF16c(ptInput, pfOutput, ulCount);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = Float16ToFloatNeon(ptInput, pfOutput, ulCount);
+#endif
+
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        pfOutput[ulIndex] = Float16ToFloat(ptInput[ulIndex]);
+    }
+}
 
 /////////////////////////////////////////////////////////////////////////////
-// METHOD NAME: FloatLib::IsNan
+// METHOD NAME: FloatLib::FloatToBFloat16
 //
-/// Returns whether the input float is not a number
+/// Converts every float in an array to a BFloat16
 ///
 /////////////////////////////////////////////////////////////////////////////
-bool IsNan(float fInput) 
+void FloatToBFloat16(const float * pfInput, BFloat16 * ptOutput, uint32_t ulCount)
 {
-    return FpClassify(fInput) == FLP_NAN;
+    uint32_t ulIndex = 0;
+
+#if defined(FLOATLIB_AVX2)
+    if (IsAvx2Supported())
+    {
+        ulIndex = FloatToBFloat16Avx2(pfInput, ptOutput, ulCount);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = FloatToBFloat16Neon(pfInput, ptOutput, ulCount);
+#endif
+
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        ptOutput[ulIndex] = FloatToBFloat16(pfInput[ulIndex]);
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////
-// METHOD NAME: FloatLib::IsInf
+// METHOD NAME: FloatLib::BFloat16ToFloat
 //
-/// Returns whether the input float is infinite
+/// Converts every BFloat16 in an array to a float
 ///
 /////////////////////////////////////////////////////////////////////////////
-bool IsInf(float fInput) 
+void BFloat16ToFloat(const BFloat16 * ptInput, float * pfOutput, uint32_t ulCount)
 {
-    return FpClassify(fInput) == FLP_INFINITE;
+    uint32_t ulIndex = 0;
+
+#if defined(FLOATLIB_AVX2)
+    if (IsAvx2Supported())
+    {
+        ulIndex = BFloat16ToFloatAvx2(ptInput, pfOutput, ulCount);
+    }
+#elif defined(FLOATLIB_NEON)
+    ulIndex = BFloat16ToFloatNeon(ptInput, pfOutput, ulCount);
+#endif
+
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        pfOutput[ulIndex] = BFloat16ToFloat(ptInput[ulIndex]);
+    }
 }
-  
+
 } // namespace App
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -7,6 +7,11 @@
 /// @if REVISION_HISTORY_INCLUDED
 /// @par Edit History
 /// - jmccaff 1-Apr-2016 Original Implementation
+/// - agent 16-Oct-2026 FLOAT_INFINITY and FLOAT_NAN hold the real IEEE values, no longer the finite 2139095040.0f
+///   and 2147483648.0f, so RateOfChange returns a real infinity on equal timestamps
+/// - agent 16-Oct-2026 Added array classification kernels
+/// - agent 16-Oct-2026 Scalar functions moved inline as branchless constexpr, added IsFinite and IsSubnormal
+/// - agent 16-Oct-2026 Added the Float16 and BFloat16 storage formats with classification and conversions
 /// @endif
 ///
 /// @ingroup App
@@ -18,6 +23,13 @@
 
 // SYSTEM INCLUDES
 #include <stdint.h>
+#include <string.h>
+#include <limits>
+#if (__cplusplus >= 202002L) && defined(__has_include)
+#if __has_include(<bit>)
+#include <bit>
+#endif
+#endif
 
 // C PROJECT INCLUDES
 // (none)
@@ -27,6 +39,24 @@
 // FORWARD REFERENCES
 // (none)
 
+//
+// The scalar functions are constexpr when the compiler can reinterpret float bits in a constant expression, through
+// C++20 std::bit_cast or the equivalent builtin in GCC 11 and Clang 9.  Older compilers get plain inline functions
+// that copy the bits with memcpy, which optimizes to a register move.
+//
+#if defined(__cpp_lib_bit_cast)
+#define FLOATLIB_CONSTEXPR constexpr
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+#define FLOATLIB_BUILTIN_BIT_CAST
+#define FLOATLIB_CONSTEXPR constexpr
+#endif
+#endif
+
+#if !defined(FLOATLIB_CONSTEXPR)
+#define FLOATLIB_CONSTEXPR inline
+#endif
+
 namespace App
 {
 	
@@ -39,8 +69,98 @@ enum FloatType
     FLP_SUBNORMAL,
     FLP_ZERO
 };
-static const float FLOAT_INFINITY = 0x7F800000U;
-static const float FLOAT_NAN = 0x7FFFFFFFU;
+
+// Number of float types in enum FloatType
+static const uint32_t FLP_TYPE_COUNT = 5U;
+
+// Float type selection masks for FpFindFirst, one bit per FloatType
+static const uint32_t FLP_MASK_INFINITE  = 1U << FLP_INFINITE;
+static const uint32_t FLP_MASK_NAN       = 1U << FLP_NAN;
+static const uint32_t FLP_MASK_NORMAL    = 1U << FLP_NORMAL;
+static const uint32_t FLP_MASK_SUBNORMAL = 1U << FLP_SUBNORMAL;
+static const uint32_t FLP_MASK_ZERO      = 1U << FLP_ZERO;
+
+// Result of scanning an array of floats with FpScan
+struct FloatScanResult
+{
+    uint32_t aulCount[FLP_TYPE_COUNT];        ///< Number of elements of each FloatType
+    uint32_t aulFirstIndex[FLP_TYPE_COUNT];   ///< Index of the first element of each FloatType, the count if none
+};
+
+// IEEE positive infinity and quiet NaN.  Initialising a float from the integer bit patterns would convert the integer
+// values instead of reinterpreting the bits, so the limits are taken from the standard library.
+//
+// Until 16-Oct-2026 they were initialised that way and held the finite values 2139095040.0f and 2147483648.0f.
+// Anything comparing against those values, such as a rate of change on equal timestamps, must test with IsInf and
+// IsNan instead.
+static constexpr float FLOAT_INFINITY = std::numeric_limits<float>::infinity();
+static constexpr float FLOAT_NAN = std::numeric_limits<float>::quiet_NaN();
+
+// Float bit mask without the sign bit
+static const uint32_t FLOAT_MAGNITUDE_MASK  = 0x7FFFFFFFU;
+// Bits of an infinite float without the sign bit, any magnitude above is a NaN
+static const uint32_t FLOAT_INFINITE_BITS   = 0x7F800000U;
+// Bits of the smallest normal float, non zero magnitudes below it are subnormal
+static const uint32_t FLOAT_MIN_NORMAL_BITS = 0x00800000U;
+
+// IEEE 754 half precision value, 1 sign, 5 exponent and 10 fraction bits, for compact storage only
+struct Float16
+{
+    uint16_t uwBits;    ///< Encoded value
+};
+
+// Brain floating point value, the upper half of a float, 1 sign, 8 exponent and 7 fraction bits, for compact storage
+struct BFloat16
+{
+    uint16_t uwBits;    ///< Encoded value
+};
+
+// Float16 bit mask without the sign bit, bits of an infinite value and bits of the smallest normal value
+static const uint16_t FLOAT16_MAGNITUDE_MASK   = 0x7FFFU;
+static const uint16_t FLOAT16_INFINITE_BITS    = 0x7C00U;
+static const uint16_t FLOAT16_MIN_NORMAL_BITS  = 0x0400U;
+
+// BFloat16 bit mask without the sign bit, bits of an infinite value and bits of the smallest normal value
+static const uint16_t BFLOAT16_MAGNITUDE_MASK  = 0x7FFFU;
+static const uint16_t BFLOAT16_INFINITE_BITS   = 0x7F80U;
+static const uint16_t BFLOAT16_MIN_NORMAL_BITS = 0x0080U;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///@begin_claim_coding_exception
+///
+/// Rule 3-9-3
+/// The underlying bit representations must be used to determine the classification of floating point values
+///
+//@end_claim_coding_exception
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///@begin_code_exception
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FloatToBits
+//
+/// @par Full Description
+/// This function returns the IEEE bit pattern of a float
+///
+/// @param  fInput       The float to be reinterpreted
+/// @return ulBits       The bits of the float
+///
+/// @pre none
+/// @post The bits of the input will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR uint32_t FloatToBits(float fInput)
+{
+#if defined(__cpp_lib_bit_cast)
+    return std::bit_cast<uint32_t>(fInput);
+#elif defined(FLOATLIB_BUILTIN_BIT_CAST)
+    return __builtin_bit_cast(uint32_t, fInput);
+#else
+    uint32_t ulBits;
+    memcpy(&ulBits, &fInput, sizeof(ulBits));
+    return ulBits;
+#endif
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //  FUNCTION NAME: IsNan
@@ -56,7 +176,10 @@ static const float FLOAT_NAN = 0x7FFFFFFFU;
 ///
 /// @ingroup APP
 ////////////////////////////////////////////////////////////////////////////////
-bool IsNan(float fInput);
+FLOATLIB_CONSTEXPR bool IsNan(float fInput)
+{
+    return (FloatToBits(fInput) & FLOAT_MAGNITUDE_MASK) > FLOAT_INFINITE_BITS;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //  FUNCTION NAME: IsInf
@@ -72,13 +195,86 @@ bool IsNan(float fInput);
 ///
 /// @ingroup APP
 ////////////////////////////////////////////////////////////////////////////////
-bool IsInf(float fInput);
+FLOATLIB_CONSTEXPR bool IsInf(float fInput)
+{
+    return (FloatToBits(fInput) & FLOAT_MAGNITUDE_MASK) == FLOAT_INFINITE_BITS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: IsFinite
+//
+/// @par Full Description
+/// This function returns whether the input float is neither infinite nor NaN
+///
+/// @param  fInput       The float to be checked
+/// @return bIsFinite    Is the float finite
+///
+/// @pre none
+/// @post Whether the input is finite will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR bool IsFinite(float fInput)
+{
+    return (FloatToBits(fInput) & FLOAT_MAGNITUDE_MASK) < FLOAT_INFINITE_BITS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: IsSubnormal
+//
+/// @par Full Description
+/// This function returns whether the input float is subnormal
+///
+/// @param  fInput       The float to be checked
+/// @return bIsSubnormal Is the float subnormal
+///
+/// @pre none
+/// @post Whether the input is subnormal will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR bool IsSubnormal(float fInput)
+{
+    // Zero wraps around to the largest magnitude, leaving exactly the non zero magnitudes below the smallest normal
+    return ((FloatToBits(fInput) & FLOAT_MAGNITUDE_MASK) - 1U) < (FLOAT_MIN_NORMAL_BITS - 1U);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: ClassifyMagnitude
+//
+/// @par Full Description
+/// This function classifies the bits of a floating point number of any
+/// format, without the sign bit.  Every test is evaluated and the results
+/// combined arithmetically, so the classification has no branches.
+///
+/// @param  ulMagnitude      The bits to be classified, without the sign bit
+/// @param  ulInfiniteBits   The bits of an infinite value in the format
+/// @param  ulMinNormalBits  The bits of the smallest normal value in the format
+/// @return eFloatType       The type of float from enum FloatType
+///
+/// @pre none
+/// @post The classification will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+constexpr FloatType ClassifyMagnitude(uint32_t ulMagnitude, uint32_t ulInfiniteBits, uint32_t ulMinNormalBits)
+{
+    // Each test is 0 or 1 and at most one of them is 1, a value passing none of them is normal
+    return static_cast<FloatType>(FLP_NORMAL +
+                                  (static_cast<int32_t>(ulMagnitude == ulInfiniteBits) * (FLP_INFINITE - FLP_NORMAL)) +
+                                  (static_cast<int32_t>(ulMagnitude > ulInfiniteBits) * (FLP_NAN - FLP_NORMAL)) +
+                                  (static_cast<int32_t>((ulMagnitude - 1U) < (ulMinNormalBits - 1U)) *
+                                   (FLP_SUBNORMAL - FLP_NORMAL)) +
+                                  (static_cast<int32_t>(ulMagnitude == 0U) * (FLP_ZERO - FLP_NORMAL)));
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 //  FUNCTION NAME: FpClassify
 //
 /// @par Full Description
-/// This function classifies a floating point number based of it's bits
+/// This function classifies a floating point number based of it's bits.
+/// Every test is evaluated and the results combined arithmetically, so the
+/// classification has no branches.
 ///
 /// @param  fInput       The float to be classified
 /// @return eFloatType   The type of float from enum FloatType
@@ -88,7 +284,393 @@ bool IsInf(float fInput);
 ///
 /// @ingroup APP
 ////////////////////////////////////////////////////////////////////////////////
-FloatType FpClassify(float fInput);
+FLOATLIB_CONSTEXPR FloatType FpClassify(float fInput)
+{
+    return ClassifyMagnitude(FloatToBits(fInput) & FLOAT_MAGNITUDE_MASK, FLOAT_INFINITE_BITS, FLOAT_MIN_NORMAL_BITS);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: BitsToFloat
+//
+/// @par Full Description
+/// This function returns the float with an IEEE bit pattern
+///
+/// @param  ulBits       The bits to be reinterpreted
+/// @return fOutput      The float with those bits
+///
+/// @pre none
+/// @post The float of the input bits will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR float BitsToFloat(uint32_t ulBits)
+{
+#if defined(__cpp_lib_bit_cast)
+    return std::bit_cast<float>(ulBits);
+#elif defined(FLOATLIB_BUILTIN_BIT_CAST)
+    return __builtin_bit_cast(float, ulBits);
+#else
+    float fOutput;
+    memcpy(&fOutput, &ulBits, sizeof(fOutput));
+    return fOutput;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: IsNan, IsInf, IsFinite, IsSubnormal, FpClassify
+//
+/// @par Full Description
+/// The scalar classification functions for a Float16, working on the 16 bit
+/// encoding directly so a stored value is classified without converting it.
+/// A Float16 subnormal converts to a normal float.
+///
+/// @param  tInput       The Float16 to be checked
+///
+/// @pre none
+/// @post The classification in the Float16 format will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR bool IsNan(Float16 tInput)
+{
+    return (tInput.uwBits & FLOAT16_MAGNITUDE_MASK) > FLOAT16_INFINITE_BITS;
+}
+
+FLOATLIB_CONSTEXPR bool IsInf(Float16 tInput)
+{
+    return (tInput.uwBits & FLOAT16_MAGNITUDE_MASK) == FLOAT16_INFINITE_BITS;
+}
+
+FLOATLIB_CONSTEXPR bool IsFinite(Float16 tInput)
+{
+    return (tInput.uwBits & FLOAT16_MAGNITUDE_MASK) < FLOAT16_INFINITE_BITS;
+}
+
+FLOATLIB_CONSTEXPR bool IsSubnormal(Float16 tInput)
+{
+    return ((tInput.uwBits & FLOAT16_MAGNITUDE_MASK) - 1U) < (FLOAT16_MIN_NORMAL_BITS - 1U);
+}
+
+FLOATLIB_CONSTEXPR FloatType FpClassify(Float16 tInput)
+{
+    return ClassifyMagnitude(tInput.uwBits & FLOAT16_MAGNITUDE_MASK, FLOAT16_INFINITE_BITS, FLOAT16_MIN_NORMAL_BITS);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: IsNan, IsInf, IsFinite, IsSubnormal, FpClassify
+//
+/// @par Full Description
+/// The scalar classification functions for a BFloat16, working on the 16 bit
+/// encoding directly so a stored value is classified without converting it.
+///
+/// @param  tInput       The BFloat16 to be checked
+///
+/// @pre none
+/// @post The classification in the BFloat16 format will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR bool IsNan(BFloat16 tInput)
+{
+    return (tInput.uwBits & BFLOAT16_MAGNITUDE_MASK) > BFLOAT16_INFINITE_BITS;
+}
+
+FLOATLIB_CONSTEXPR bool IsInf(BFloat16 tInput)
+{
+    return (tInput.uwBits & BFLOAT16_MAGNITUDE_MASK) == BFLOAT16_INFINITE_BITS;
+}
+
+FLOATLIB_CONSTEXPR bool IsFinite(BFloat16 tInput)
+{
+    return (tInput.uwBits & BFLOAT16_MAGNITUDE_MASK) < BFLOAT16_INFINITE_BITS;
+}
+
+FLOATLIB_CONSTEXPR bool IsSubnormal(BFloat16 tInput)
+{
+    return ((tInput.uwBits & BFLOAT16_MAGNITUDE_MASK) - 1U) < (BFLOAT16_MIN_NORMAL_BITS - 1U);
+}
+
+FLOATLIB_CONSTEXPR FloatType FpClassify(BFloat16 tInput)
+{
+    return ClassifyMagnitude(tInput.uwBits & BFLOAT16_MAGNITUDE_MASK, BFLOAT16_INFINITE_BITS, BFLOAT16_MIN_NORMAL_BITS);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FloatToFloat16
+//
+/// @par Full Description
+/// This function converts a float to a Float16, rounding to nearest even.
+/// Magnitudes from 65520 up become infinite, those below the smallest
+/// subnormal become zero, and a NaN stays a quiet NaN keeping the top of its
+/// payload, the same results as the F16C and NEON conversion instructions.
+///
+/// @param  fInput       The float to be converted
+/// @return tOutput      The nearest Float16
+///
+/// @pre none
+/// @post The converted input will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR Float16 FloatToFloat16(float fInput)
+{
+    const uint32_t ulBits      = FloatToBits(fInput);
+    const uint32_t ulSign      = (ulBits >> 16) & 0x8000U;
+    const uint32_t ulMagnitude = ulBits & FLOAT_MAGNITUDE_MASK;
+    uint32_t       ulOutput    = 0U;
+
+    if (ulMagnitude > FLOAT_INFINITE_BITS)
+    {
+        ulOutput = FLOAT16_INFINITE_BITS | 0x0200U | ((ulMagnitude >> 13) & 0x03FFU);
+    }
+    else if (ulMagnitude >= 0x477FF000U)
+    {
+        ulOutput = FLOAT16_INFINITE_BITS;
+    }
+    else if (ulMagnitude >= 0x38800000U)
+    {
+        // Rebias the exponent from 127 to 15 and round off the low 13 fraction bits, a carry moves up the exponent
+        const uint32_t ulRebiased = ulMagnitude - 0x38000000U;
+        ulOutput = (ulRebiased + 0x0FFFU + ((ulRebiased >> 13) & 1U)) >> 13;
+    }
+    else if (ulMagnitude >= 0x33000000U)
+    {
+        // Subnormal, the fraction with its implicit bit shifted down to units of 2^-24
+        const uint32_t ulFraction = (ulMagnitude & 0x007FFFFFU) | FLOAT_MIN_NORMAL_BITS;
+        const uint32_t ulShift    = 126U - (ulMagnitude >> 23);
+        ulOutput = (ulFraction + (1U << (ulShift - 1U)) - 1U + ((ulFraction >> ulShift) & 1U)) >> ulShift;
+    }
+
+    const Float16 tOutput = { static_cast<uint16_t>(ulSign | ulOutput) };
+    return tOutput;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: Float16ToFloat
+//
+/// @par Full Description
+/// This function converts a Float16 to a float, which is always exact.  A
+/// NaN becomes a quiet NaN keeping its payload, as the F16C and NEON
+/// conversion instructions do.
+///
+/// @param  tInput       The Float16 to be converted
+/// @return fOutput      The equal float
+///
+/// @pre none
+/// @post The converted input will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR float Float16ToFloat(Float16 tInput)
+{
+    const uint32_t ulSign      = static_cast<uint32_t>(tInput.uwBits & 0x8000U) << 16;
+    const uint32_t ulMagnitude = tInput.uwBits & FLOAT16_MAGNITUDE_MASK;
+    uint32_t       ulOutput    = 0U;
+
+    if (ulMagnitude > FLOAT16_INFINITE_BITS)
+    {
+        ulOutput = FLOAT_INFINITE_BITS | 0x00400000U | ((ulMagnitude & 0x03FFU) << 13);
+    }
+    else if (ulMagnitude == FLOAT16_INFINITE_BITS)
+    {
+        ulOutput = FLOAT_INFINITE_BITS;
+    }
+    else if (ulMagnitude >= FLOAT16_MIN_NORMAL_BITS)
+    {
+        ulOutput = (ulMagnitude << 13) + 0x38000000U;
+    }
+    else
+    {
+        // Zero or subnormal, a count of 2^-24 that is exact as a float
+        ulOutput = FloatToBits(static_cast<float>(ulMagnitude) * 5.9604644775390625e-8F);
+    }
+
+    return BitsToFloat(ulSign | ulOutput);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FloatToBFloat16
+//
+/// @par Full Description
+/// This function converts a float to a BFloat16 by rounding off the low 16
+/// bits to nearest even.  The exponent range is the same as a float, so only
+/// the largest finite magnitudes round up to infinite.  A NaN stays a quiet
+/// NaN keeping the top of its payload.
+///
+/// @param  fInput       The float to be converted
+/// @return tOutput      The nearest BFloat16
+///
+/// @pre none
+/// @post The converted input will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR BFloat16 FloatToBFloat16(float fInput)
+{
+    const uint32_t ulBits = FloatToBits(fInput);
+    const uint32_t ulOutput = ((ulBits & FLOAT_MAGNITUDE_MASK) > FLOAT_INFINITE_BITS) ?
+                              ((ulBits >> 16) | 0x0040U) :
+                              ((ulBits + 0x7FFFU + ((ulBits >> 16) & 1U)) >> 16);
+
+    const BFloat16 tOutput = { static_cast<uint16_t>(ulOutput) };
+    return tOutput;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: BFloat16ToFloat
+//
+/// @par Full Description
+/// This function converts a BFloat16 to a float, which is always exact.
+///
+/// @param  tInput       The BFloat16 to be converted
+/// @return fOutput      The equal float
+///
+/// @pre none
+/// @post The converted input will be returned
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+FLOATLIB_CONSTEXPR float BFloat16ToFloat(BFloat16 tInput)
+{
+    return BitsToFloat(static_cast<uint32_t>(tInput.uwBits) << 16);
+}
+//@end_code_exception
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FpClassify
+//
+/// @par Full Description
+/// This function classifies every float in an array.  The classification uses
+/// integer mask compares on the bit patterns, vectorized with AVX2 when the CPU
+/// supports it at run time or NEON on AArch64.
+///
+/// @param  pfInput      The floats to be classified
+/// @param  pubTypes     The FloatType of each float
+/// @param  ulCount      The number of floats
+/// @return none
+///
+/// @pre none
+/// @post The classification of each float will be written to pubTypes
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+void FpClassify(const float * pfInput, uint8_t * pubTypes, uint32_t ulCount);
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FpScan
+//
+/// @par Full Description
+/// This function counts the floats of each FloatType in an array and finds the
+/// first float of each FloatType, without storing per element results.
+///
+/// @param  pfInput      The floats to be scanned
+/// @param  ulCount      The number of floats
+/// @param  rResult      The counts and first indexes of each FloatType
+/// @return none
+///
+/// @pre none
+/// @post The scan result will be written to rResult
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+void FpScan(const float * pfInput, uint32_t ulCount, FloatScanResult & rResult);
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FpFindFirst
+//
+/// @par Full Description
+/// This function returns the index of the first float in an array whose
+/// FloatType is selected by the mask, stopping as soon as it is found.
+///
+/// @param  pfInput      The floats to be searched
+/// @param  ulCount      The number of floats
+/// @param  ulTypeMask   FLP_MASK_ values of the FloatTypes to search for
+/// @return ulIndex      Index of the first match, ulCount when there is none
+///
+/// @pre none
+/// @post none
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+uint32_t FpFindFirst(const float * pfInput, uint32_t ulCount, uint32_t ulTypeMask);
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FloatToFloat16
+//
+/// @par Full Description
+/// This function converts every float in an array to a Float16, with the
+/// results of the scalar FloatToFloat16.  Vectorized with F16C when the CPU
+/// supports it at run time or NEON on AArch64.
+///
+/// @param  pfInput      The floats to be converted
+/// @param  ptOutput     The converted values
+/// @param  ulCount      The number of floats
+/// @return none
+///
+/// @pre none
+/// @post The converted values will be written to ptOutput
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+void FloatToFloat16(const float * pfInput, Float16 * ptOutput, uint32_t ulCount);
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: Float16ToFloat
+//
+/// @par Full Description
+/// This function converts every Float16 in an array to a float.  Vectorized
+/// with F16C when the CPU supports it at run time or NEON on AArch64.
+///
+/// @param  ptInput      The values to be converted
+/// @param  pfOutput     The converted floats
+/// @param  ulCount      The number of values
+/// @return none
+///
+/// @pre none
+/// @post The converted floats will be written to pfOutput
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+void Float16ToFloat(const Float16 * ptInput, float * pfOutput, uint32_t ulCount);
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: FloatToBFloat16
+//
+/// @par Full Description
+/// This function converts every float in an array to a BFloat16, with the
+/// results of the scalar FloatToBFloat16.  Vectorized with AVX2 when the CPU
+/// supports it at run time or NEON on AArch64.
+///
+/// @param  pfInput      The floats to be converted
+/// @param  ptOutput     The converted values
+/// @param  ulCount      The number of floats
+/// @return none
+///
+/// @pre none
+/// @post The converted values will be written to ptOutput
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+void FloatToBFloat16(const float * pfInput, BFloat16 * ptOutput, uint32_t ulCount);
+
+////////////////////////////////////////////////////////////////////////////////
+//  FUNCTION NAME: BFloat16ToFloat
+//
+/// @par Full Description
+/// This function converts every BFloat16 in an array to a float.  Vectorized
+/// with AVX2 when the CPU supports it at run time or NEON on AArch64.
+///
+/// @param  ptInput      The values to be converted
+/// @param  pfOutput     The converted floats
+/// @param  ulCount      The number of values
+/// @return none
+///
+/// @pre none
+/// @post The converted floats will be written to pfOutput
+///
+/// @ingroup APP
+////////////////////////////////////////////////////////////////////////////////
+void BFloat16ToFloat(const BFloat16 * ptInput, float * pfOutput, uint32_t ulCount);
     
 } //namespace App
 
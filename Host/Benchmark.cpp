@@ -0,0 +1,897 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file Benchmark.cpp
+///
+/// Description Host microbenchmarks for FloatLib, CompactHistory, RateOfChange, FixedPeriodRateOfChange,
+///             LazyRateOfChange, MultiHorizonRateOfChange, SampleRing, ChannelRegistry, RateAlarmBank,
+///             RateExceptionReporter, SampleScrubber, SignalPipeline and Watchdog
+///
+/// @par Full Description
+/// Times the hot paths of the modules on a Linux host against reproducible inputs and optionally compares the
+/// results with a stored baseline.
+///
+/// Usage: Benchmark [--baseline FILE] [--write-baseline FILE] [--tolerance PERCENT]
+///   --baseline        Compare with FILE and fail when any case is slower by more than the tolerance.
+///   --write-baseline  Store the results in FILE.
+///   --tolerance       Allowed slow down in percent, 25 by default.
+///
+/// Inputs come from a fixed seed generator, so every run times exactly the same data:
+/// - normals:    finite normal floats with random sign and exponent,
+/// - mixed:      normals with subnormals, NaNs of both signs and varied payloads, infinities and zeros mixed in,
+/// - timestamps: 1 ms samples with jitter and occasional repeats, starting just before the 32 bit microsecond
+///               counter overflows so that every pass crosses the wrap.
+/// Each case takes microseconds, so a single preemption or frequency step shows up as tens of percent.  Each case is
+/// therefore repeated within a pass, all cases are run in several passes, and the fastest time per operation is
+/// reported: noise only ever adds time, so the minimum is what repeats between runs.  While a case is still slower
+/// than the baseline allows, further passes are run, up to a limit, so that a busy moment on the host is not taken
+/// for a regression.  Baselines are only meaningful on the machine and build type they were recorded with.
+///
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added the steady state RateAlarmBank scan
+/// - agent 16-Oct-2026 Added the fused five stage SignalPipeline
+/// - agent 16-Oct-2026 Added the three horizon MultiHorizonRateOfChange
+/// - agent 16-Oct-2026 Added the clean buffer SampleScrubber scan
+/// - agent 16-Oct-2026 Added the traced KickWatchdog
+/// - agent 16-Oct-2026 Added KickWatchdog through WatchdogPolicy
+/// - agent 16-Oct-2026 Added the ChannelRegistry recipe reload
+/// - agent 16-Oct-2026 Added the Float16 and BFloat16 CompactHistory decode
+/// - agent 16-Oct-2026 Added the LazyRateOfChange record path
+/// - agent 16-Oct-2026 Added the steady state RateExceptionReporter scan
+/// - agent 16-Oct-2026 Added the FixedPeriodRateOfChange stream and batch
+/// - agent 16-Oct-2026 The traced kicks record to the built in .noinit trace region
+/// - agent 16-Oct-2026 Fastest of several passes reported and a 25% default tolerance, the median was flaky
+/// - agent 16-Oct-2026 Added the SampleRing burst push and drain
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "ChannelRegistry.hpp"
+#include "CompactHistory.hpp"
+#include "FixedPeriodRateOfChange.hpp"
+#include "FloatLib.hpp"
+#include "LazyRateOfChange.hpp"
+#include "MultiHorizonRateOfChange.hpp"
+#include "RateAlarmBank.hpp"
+#include "RateExceptionReporter.hpp"
+#include "RateOfChange.hpp"
+#include "SampleRing.hpp"
+#include "SampleScrubber.hpp"
+#include "SignalPipeline.hpp"
+#include "Watchdog.hpp"
+#include "WatchdogPolicy.hpp"
+#include "WatchdogTrace.hpp"
+#include "WatchdogWindow.hpp"
+#include "IWdtSimulator.hpp"
+
+namespace
+{
+    // Samples per input set, small enough to stay in cache
+    const uint32_t SAMPLE_COUNT = 4096u;
+
+    // Timed repetitions of each case within a pass, the fastest is reported
+    const uint32_t REPETITIONS = 15u;
+
+    // Passes over all cases, the fastest pass of each case is kept.  Up to MAX_PASSES while a case regresses.
+    const uint32_t PASSES = 5u;
+    const uint32_t MAX_PASSES = 100u;
+
+    // Fixed generator seed so every run sees the same inputs
+    const uint32_t INPUT_SEED = 0x5EEDu;
+
+    // Default allowed slow down against the baseline in percent
+    const double DEFAULT_TOLERANCE_PERCENT = 25.0;
+
+    // Consumes benchmark results so the compiler cannot discard the work
+    volatile uint32_t g_ulSink;
+
+    // One timed case
+    struct BenchmarkResult
+    {
+        std::string strName;
+        double      dNsPerOp;
+    };
+
+    // Reproducible benchmark inputs
+    struct BenchmarkInputs
+    {
+        std::vector<float>    afNormals;
+        std::vector<float>    afMixed;
+        std::vector<uint32_t> aulTimestampsUs;
+    };
+
+    // Watchdog with the window fully open and the longest timeout, so that every refresh timed is legal
+    struct BenchmarkWatchdogConfig
+    {
+        static const uint32_t            TIMEOUT_US = 0xFFFFFFFFu;
+        static const CpfBsp::WindowStart WINDOW_START = CpfBsp::WINDOW_START_0;
+        static const CpfBsp::WindowEnd   WINDOW_END = CpfBsp::WINDOW_END_100;
+        static const uint32_t            CLOCK_TOLERANCE_PERCENT = 0u;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: BitsToFloat
+    ///
+    /// @return the float with the given bit pattern
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    float BitsToFloat(uint32_t ulBits)
+    {
+        float fValue;
+
+        memcpy(&fValue, &ulBits, sizeof(fValue));
+
+        return fValue;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: MakeInputs
+    ///
+    /// @par Full Description
+    /// Builds the input sets from the raw output of a fixed seed Mersenne Twister.  The standard distributions are
+    /// not used as their output differs between standard libraries.
+    ///
+    /// @return the benchmark inputs
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BenchmarkInputs MakeInputs(void)
+    {
+        std::mt19937 Generator(INPUT_SEED);
+        BenchmarkInputs Inputs;
+
+        const uint32_t SIGN_BIT = 0x80000000u;
+        const uint32_t EXPONENT_SHIFT = 23u;
+        const uint32_t MANTISSA_MASK = 0x007FFFFFu;
+        const uint32_t INFINITE_BITS = 0x7F800000u;
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            uint32_t ulSign = Generator() & SIGN_BIT;
+            uint32_t ulMantissa = Generator() & MANTISSA_MASK;
+
+            // Exponent 1 to 254, a normal float
+            uint32_t ulExponent = 1u + (Generator() % 254u);
+
+            Inputs.afNormals.push_back(BitsToFloat(ulSign | (ulExponent << EXPONENT_SHIFT) | ulMantissa));
+
+            uint32_t ulPercent = Generator() % 100u;
+            uint32_t ulBits = ulSign | (ulExponent << EXPONENT_SHIFT) | ulMantissa;
+
+            if (ulPercent >= 94u)
+            {
+                ulBits = ulSign;                                            // zero
+            }
+            else if (ulPercent >= 88u)
+            {
+                ulBits = ulSign | INFINITE_BITS;                            // infinity
+            }
+            else if (ulPercent >= 80u)
+            {
+                ulBits = ulSign | INFINITE_BITS | (ulMantissa | 1u);        // NaN
+            }
+            else if (ulPercent >= 70u)
+            {
+                ulBits = ulSign | (ulMantissa | 1u);                        // subnormal
+            }
+
+            Inputs.afMixed.push_back(BitsToFloat(ulBits));
+        }
+
+        // Nominal 1 ms sample period with +/- 32 us of jitter and a repeated timestamp about one sample in 256
+        uint32_t ulTimestampUs = 0xFFFFFFFFu - ((SAMPLE_COUNT / 2u) * 1000u);
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            uint32_t ulRandom = Generator();
+
+            if ((ulRandom & 0xFFu) != 0u)
+            {
+                ulTimestampUs += 1000u + ((ulRandom >> 8) & 63u) - 32u;
+            }
+
+            Inputs.aulTimestampsUs.push_back(ulTimestampUs);
+        }
+
+        return Inputs;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: Measure
+    ///
+    /// @par Full Description
+    /// Runs rBody once to warm up and then REPETITIONS times.
+    ///
+    /// @param  [in]  rBody         Function object performing ulOpsPerCall operations.
+    /// @param  [in]  ulOpsPerCall  Operations performed by each call of rBody.
+    ///
+    /// @return fastest nanoseconds per operation
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename Body>
+    double Measure(const Body & rBody, uint32_t ulOpsPerCall)
+    {
+        std::vector<double> adNsPerOp;
+
+        rBody();
+
+        for (uint32_t ulRepetition = 0; ulRepetition < REPETITIONS; ++ulRepetition)
+        {
+            std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+
+            rBody();
+
+            std::chrono::steady_clock::time_point Stop = std::chrono::steady_clock::now();
+
+            double dNs = std::chrono::duration<double, std::nano>(Stop - Start).count();
+
+            adNsPerOp.push_back(dNs / ulOpsPerCall);
+        }
+
+        return *std::min_element(adNsPerOp.begin(), adNsPerOp.end());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: FloatBits
+    ///
+    /// @return the bit pattern of a float, for folding results into the sink
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t FloatBits(float fValue)
+    {
+        uint32_t ulBits;
+
+        memcpy(&ulBits, &fValue, sizeof(ulBits));
+
+        return ulBits;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: RunFloatLib
+    ///
+    /// @param  [in]  rInputs   Benchmark inputs.
+    /// @param  [out] rResults  Results appended.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RunFloatLib(const BenchmarkInputs & rInputs, std::vector<BenchmarkResult> & rResults)
+    {
+        const float * pfNormals = rInputs.afNormals.data();
+        const float * pfMixed = rInputs.afMixed.data();
+        std::vector<uint8_t> aubTypes(SAMPLE_COUNT);
+
+        BenchmarkResult Result;
+
+        Result.strName = "FpClassify/scalar/normals";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulSum += static_cast<uint32_t>(App::FpClassify(pfNormals[ulIndex]));
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "FpClassify/scalar/mixed";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulSum += static_cast<uint32_t>(App::FpClassify(pfMixed[ulIndex]));
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "FpClassify/array/mixed";
+        Result.dNsPerOp = Measure([&]()
+        {
+            App::FpClassify(pfMixed, aubTypes.data(), SAMPLE_COUNT);
+
+            g_ulSink = aubTypes[SAMPLE_COUNT - 1u];
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "IsNan/mixed";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulCount = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulCount += App::IsNan(pfMixed[ulIndex]) ? 1u : 0u;
+            }
+
+            g_ulSink = ulCount;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "IsInf/mixed";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulCount = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulCount += App::IsInf(pfMixed[ulIndex]) ? 1u : 0u;
+            }
+
+            g_ulSink = ulCount;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // Decode of a whole 16 bit history, the ring has wrapped so it is copied in two runs
+        static SignalChain::CompactHistory<App::Float16, SAMPLE_COUNT> HalfHistory;
+        static SignalChain::CompactHistory<App::BFloat16, SAMPLE_COUNT> BrainHistory;
+        std::vector<float> afDecoded(SAMPLE_COUNT);
+
+        HalfHistory.Push(pfMixed, SAMPLE_COUNT);
+        HalfHistory.Push(pfMixed, SAMPLE_COUNT / 3u);
+        BrainHistory.Push(pfMixed, SAMPLE_COUNT);
+        BrainHistory.Push(pfMixed, SAMPLE_COUNT / 3u);
+
+        Result.strName = "CompactHistory/f16/copy";
+        Result.dNsPerOp = Measure([&]()
+        {
+            g_ulSink = HalfHistory.CopyLatest(afDecoded.data(), SAMPLE_COUNT) + FloatBits(afDecoded[0]);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "CompactHistory/bf16/copy";
+        Result.dNsPerOp = Measure([&]()
+        {
+            g_ulSink = BrainHistory.CopyLatest(afDecoded.data(), SAMPLE_COUNT) + FloatBits(afDecoded[0]);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: RunRateOfChange
+    ///
+    /// @param  [in]  rInputs   Benchmark inputs.
+    /// @param  [out] rResults  Results appended.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void RunRateOfChange(const BenchmarkInputs & rInputs, std::vector<BenchmarkResult> & rResults)
+    {
+        const float * pfValues = rInputs.afMixed.data();
+        const uint32_t * pulTimestampsUs = rInputs.aulTimestampsUs.data();
+        std::vector<float> afRates(SAMPLE_COUNT);
+
+        SignalChain::RateOfChange Rate;
+        BenchmarkResult Result;
+
+        Result.strName = "CalcRateOfChangeUs/stream";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulSum += FloatBits(Rate.CalcRateOfChangeUs(pfValues[ulIndex], pulTimestampsUs[ulIndex]));
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "CalcRateOfChangeMs/stream";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulSum += FloatBits(Rate.CalcRateOfChangeMs(pfValues[ulIndex], pulTimestampsUs[ulIndex]));
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "CalcRateOfChangeSec/stream";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulSum += FloatBits(Rate.CalcRateOfChangeSec(pfValues[ulIndex], pulTimestampsUs[ulIndex]));
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // Every sample recorded and the rate read once per pass, as an HMI poll would
+        SignalChain::LazyRateOfChange<SignalChain::RateUnitSec> LazyRate;
+
+        Result.strName = "LazyRateOfChange/record";
+        Result.dNsPerOp = Measure([&]()
+        {
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                LazyRate.Record(pfValues[ulIndex], pulTimestampsUs[ulIndex]);
+            }
+
+            g_ulSink = FloatBits(LazyRate.GetRate());
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "CalcRateOfChangeUs/batch";
+        Result.dNsPerOp = Measure([&]()
+        {
+            Rate.CalcRateOfChangeUs(pfValues, pulTimestampsUs, afRates.data(), SAMPLE_COUNT);
+
+            g_ulSink = FloatBits(afRates[SAMPLE_COUNT - 1u]);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        //
+        // Samples pushed through a ring in bursts and drained into the batch kernel after each burst.  The cost per
+        // sample should stay flat from short bursts to a full ring.
+        //
+        static SignalChain::SampleRing<1024> Ring;
+        static const uint32_t BURST_SIZES[] = { 16u, 1024u };
+
+        for (uint32_t ulBurstSize : BURST_SIZES)
+        {
+            Result.strName = "SampleRing/burst" + std::to_string(ulBurstSize);
+            Result.dNsPerOp = Measure([&]()
+            {
+                for (uint32_t ulStart = 0; ulStart < SAMPLE_COUNT; ulStart += ulBurstSize)
+                {
+                    for (uint32_t ulIndex = ulStart; ulIndex < (ulStart + ulBurstSize); ++ulIndex)
+                    {
+                        Ring.Push(pfValues[ulIndex], pulTimestampsUs[ulIndex]);
+                    }
+
+                    Ring.Drain(Rate, afRates.data() + ulStart, ulBurstSize);
+                }
+
+                g_ulSink = FloatBits(afRates[SAMPLE_COUNT - 1u]) + Ring.GetOverrunCount();
+            }, SAMPLE_COUNT);
+            rResults.push_back(Result);
+        }
+
+        // The same 1 ms stream with its 32 us jitter tolerated, the repeated timestamps take the exact path
+        SignalChain::FixedPeriodRateOfChange FixedRate(1000u, 32u);
+
+        Result.strName = "FixedPeriodRate/stream";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                ulSum += FloatBits(FixedRate.CalcRateOfChangeUs(pfValues[ulIndex], pulTimestampsUs[ulIndex]));
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        Result.strName = "FixedPeriodRate/batch";
+        Result.dNsPerOp = Measure([&]()
+        {
+            FixedRate.CalcRateOfChangeUs(pfValues, pulTimestampsUs, afRates.data(), SAMPLE_COUNT);
+
+            g_ulSink = FloatBits(afRates[SAMPLE_COUNT - 1u]);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // Sanitize, scale, rate, second derivative and smooth in one pass
+        typedef SignalChain::RateStage<SignalChain::RateUnitSec> RateSecStage;
+
+        SignalChain::SignalPipeline<SignalChain::SanitizeStage,
+                                    SignalChain::ScaleStage,
+                                    RateSecStage,
+                                    SignalChain::SecondDerivativeStage,
+                                    SignalChain::LowPassStage> Pipeline(SignalChain::SanitizeStage(),
+                                                                        SignalChain::ScaleStage(0.01f, -5.0f),
+                                                                        RateSecStage(),
+                                                                        SignalChain::SecondDerivativeStage(),
+                                                                        SignalChain::LowPassStage(0.25f));
+
+        Result.strName = "SignalPipeline/fused5";
+        Result.dNsPerOp = Measure([&]()
+        {
+            Pipeline.ProcessBuffer(pfValues, pulTimestampsUs, afRates.data(), SAMPLE_COUNT);
+
+            g_ulSink = FloatBits(afRates[SAMPLE_COUNT - 1u]);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // A healthy sensor, the whole buffer is searched and nothing is replaced
+        static SignalChain::StaticSampleScrubber<1> Scrubber;
+
+        Scrubber.SetPolicy(0u, SignalChain::SCRUB_HOLD_LAST_GOOD, 0.0f, 0.0f, true);
+        std::copy(pfValues, pfValues + SAMPLE_COUNT, afRates.begin());
+
+        Result.strName = "SampleScrubber/clean";
+        Result.dNsPerOp = Measure([&]()
+        {
+            g_ulSink = Scrubber.Scrub(0u, afRates.data(), SAMPLE_COUNT);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // Short, medium and long horizons from the one decimated history
+        static const uint32_t aulHorizonsUs[3] = { 10000u, 1000000u, 60000000u };
+        SignalChain::MultiHorizonRateOfChange<3> MultiRate(aulHorizonsUs);
+        float afHorizonRates[3];
+
+        Result.strName = "MultiHorizonRate/3horizons";
+        Result.dNsPerOp = Measure([&]()
+        {
+            uint32_t ulSum = 0;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                MultiRate.CalcRatesUs(pfValues[ulIndex], pulTimestampsUs[ulIndex], afHorizonRates);
+
+                ulSum += FloatBits(afHorizonRates[2]);
+            }
+
+            g_ulSink = ulSum;
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // A recipe reload, every channel destroyed and created again in the registry storage
+        static SignalChain::ChannelRegistry<SignalChain::RateOfChange, SAMPLE_COUNT> Registry;
+
+        Result.strName = "ChannelRegistry/reload";
+        Result.dNsPerOp = Measure([&]()
+        {
+            Registry.Clear();
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                Registry.Create();
+            }
+
+            g_ulSink = Registry.GetHandle(SAMPLE_COUNT - 1u);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // A plant in steady state, every channel's rate inside its alarm limits
+        static SignalChain::StaticRateAlarmBank<SAMPLE_COUNT> AlarmBank;
+        SignalChain::RateAlarmEvent aEvents[16];
+
+        for (uint32_t ulChannel = 0; ulChannel < SAMPLE_COUNT; ++ulChannel)
+        {
+            afRates[ulChannel] = static_cast<float>(ulChannel % 100u) - 50.0f;
+
+            AlarmBank.SetLimits(ulChannel, -100.0f, 100.0f, 5.0f, 3u);
+        }
+
+        Result.strName = "RateAlarmBank/steady";
+        Result.dNsPerOp = Measure([&]()
+        {
+            g_ulSink = AlarmBank.Evaluate(afRates.data(), aEvents, 16u);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // The same steady plant reported by exception after the first scan, nothing leaves the deadbands
+        static SignalChain::StaticRateExceptionReporter<SAMPLE_COUNT> Reporter;
+        static uint32_t aulChanged[SAMPLE_COUNT];
+
+        for (uint32_t ulChannel = 0; ulChannel < SAMPLE_COUNT; ++ulChannel)
+        {
+            Reporter.SetDeadband(ulChannel, 0.5f, 1.0f, 0u);
+        }
+
+        Reporter.Evaluate(afRates.data(), aulChanged, SAMPLE_COUNT);
+
+        Result.strName = "RateExceptionReporter/steady";
+        Result.dNsPerOp = Measure([&]()
+        {
+            g_ulSink = Reporter.Evaluate(afRates.data(), aulChanged, SAMPLE_COUNT);
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: RunWatchdog
+    ///
+    /// @par Full Description
+    /// Times KickWatchdog through the register simulator, which is dominated by the simulator itself but tracks the
+    /// cost of the call path, directly, through a WatchdogPolicy and with the reset trace.  The simulator is configured
+    /// so that every refresh is legal and checked afterwards.
+    ///
+    /// @param  [out] rResults  Results appended.
+    ///
+    /// @return whether the simulator saw exactly the refreshes issued
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RunWatchdog(std::vector<BenchmarkResult> & rResults)
+    {
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+        rSimulator.PowerOn(CpfBsp::WatchdogPolicy<BenchmarkWatchdogConfig>::GetWindow());
+
+        BenchmarkResult Result;
+
+        Result.strName = "KickWatchdog";
+        Result.dNsPerOp = Measure([&]()
+        {
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                CpfBsp::Watchdog::KickWatchdog();
+            }
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // The same refreshes through a compile time policy, which should cost no more than the check for a trace
+        CpfBsp::PeriodicKicker<CpfBsp::WatchdogPolicy<BenchmarkWatchdogConfig>, 1000u> Kicker;
+
+        Result.strName = "KickWatchdog/policy";
+        Result.dNsPerOp = Measure([&]()
+        {
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                Kicker.Tick(ulIndex);
+            }
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        // The same refreshes recorded in a trace region, as left enabled in production
+        CpfBsp::WatchdogTrace::AttachNoInitRegion();
+
+        Result.strName = "KickWatchdog/traced";
+        Result.dNsPerOp = Measure([&]()
+        {
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                CpfBsp::Watchdog::KickWatchdog(1u, ulIndex);
+            }
+        }, SAMPLE_COUNT);
+        rResults.push_back(Result);
+
+        CpfBsp::WatchdogTrace::Attach(0);
+
+        uint32_t ulExpected = 3u * (REPETITIONS + 1u) * SAMPLE_COUNT;
+
+        return (rSimulator.GetRefreshCount() == ulExpected) &&
+               (rSimulator.GetResetCount() == 0u) &&
+               (rSimulator.GetSequenceErrorCount() == 0u);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: GetChangePercent
+    ///
+    /// @param  [in]  rResult     Timed case.
+    /// @param  [in]  rBaseline   Nanoseconds per operation by case name.
+    /// @param  [out] rdPercent   Change against the baseline in percent, when the case has one.
+    ///
+    /// @return whether the baseline has the case
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool GetChangePercent(const BenchmarkResult & rResult, const std::map<std::string, double> & rBaseline,
+                          double & rdPercent)
+    {
+        std::map<std::string, double>::const_iterator Found = rBaseline.find(rResult.strName);
+
+        if (Found != rBaseline.end())
+        {
+            rdPercent = ((rResult.dNsPerOp / Found->second) - 1.0) * 100.0;
+        }
+
+        return Found != rBaseline.end();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: HasRegression
+    ///
+    /// @param  [in]  rResults            Timed cases.
+    /// @param  [in]  rBaseline           Nanoseconds per operation by case name.
+    /// @param  [in]  dTolerancePercent   Allowed slow down in percent.
+    ///
+    /// @return whether any case is slower than the baseline by more than the tolerance
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool HasRegression(const std::vector<BenchmarkResult> & rResults, const std::map<std::string, double> & rBaseline,
+                       double dTolerancePercent)
+    {
+        bool bRegressed = false;
+
+        for (size_t ulIndex = 0; ulIndex < rResults.size(); ++ulIndex)
+        {
+            double dChangePercent = 0.0;
+
+            if (GetChangePercent(rResults[ulIndex], rBaseline, dChangePercent) && (dChangePercent > dTolerancePercent))
+            {
+                bRegressed = true;
+            }
+        }
+
+        return bRegressed;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: ReadBaseline
+    ///
+    /// @param  [in]  pszPath     Baseline file, lines of name and nanoseconds per operation, # comments.
+    /// @param  [out] rBaseline   Nanoseconds per operation by case name.
+    ///
+    /// @return whether the file could be read
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool ReadBaseline(const char * pszPath, std::map<std::string, double> & rBaseline)
+    {
+        std::ifstream File(pszPath);
+        std::string strLine;
+
+        while (std::getline(File, strLine))
+        {
+            char szName[128];
+            double dNsPerOp;
+
+            if ((strLine.empty() == false) && (strLine[0] != '#') &&
+                (sscanf(strLine.c_str(), "%127s %lf", szName, &dNsPerOp) == 2))
+            {
+                rBaseline[szName] = dNsPerOp;
+            }
+        }
+
+        return File.eof();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: WriteBaseline
+    ///
+    /// @param  [in]  pszPath     Baseline file to write.
+    /// @param  [in]  rResults    Results to store.
+    ///
+    /// @return whether the file was written
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool WriteBaseline(const char * pszPath, const std::vector<BenchmarkResult> & rResults)
+    {
+        FILE * pFile = fopen(pszPath, "w");
+
+        if (pFile != NULL)
+        {
+            fprintf(pFile, "# Benchmark baseline: case name and fastest nanoseconds per operation\n");
+
+            for (size_t ulIndex = 0; ulIndex < rResults.size(); ++ulIndex)
+            {
+                fprintf(pFile, "%s %.4f\n", rResults[ulIndex].strName.c_str(), rResults[ulIndex].dNsPerOp);
+            }
+
+            fclose(pFile);
+        }
+
+        return pFile != NULL;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FUNCTION NAME: main
+///
+/// @return 0 on success, 1 on a regression against the baseline, 2 on a usage, file or simulation error
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char * argv[])
+{
+    const char * pszBaseline = NULL;
+    const char * pszWriteBaseline = NULL;
+    double dTolerancePercent = DEFAULT_TOLERANCE_PERCENT;
+
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        bool bHasValue = (iArg + 1) < argc;
+
+        if ((strcmp(argv[iArg], "--baseline") == 0) && bHasValue)
+        {
+            pszBaseline = argv[++iArg];
+        }
+        else if ((strcmp(argv[iArg], "--write-baseline") == 0) && bHasValue)
+        {
+            pszWriteBaseline = argv[++iArg];
+        }
+        else if ((strcmp(argv[iArg], "--tolerance") == 0) && bHasValue)
+        {
+            dTolerancePercent = atof(argv[++iArg]);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--baseline FILE] [--write-baseline FILE] [--tolerance PERCENT]\n", argv[0]);
+
+            return 2;
+        }
+    }
+
+    std::map<std::string, double> Baseline;
+
+    if ((pszBaseline != NULL) && !ReadBaseline(pszBaseline, Baseline))
+    {
+        fprintf(stderr, "Cannot read baseline %s\n", pszBaseline);
+
+        return 2;
+    }
+
+    BenchmarkInputs Inputs = MakeInputs();
+    std::vector<BenchmarkResult> Results;
+
+    for (uint32_t ulPass = 0;
+         (ulPass < PASSES) || ((ulPass < MAX_PASSES) && HasRegression(Results, Baseline, dTolerancePercent));
+         ++ulPass)
+    {
+        std::vector<BenchmarkResult> PassResults;
+
+        RunFloatLib(Inputs, PassResults);
+        RunRateOfChange(Inputs, PassResults);
+
+        if (!RunWatchdog(PassResults))
+        {
+            fprintf(stderr, "Watchdog simulator did not see the refreshes issued\n");
+
+            return 2;
+        }
+
+        // Every pass runs the same cases in the same order
+        if (Results.empty())
+        {
+            Results = PassResults;
+        }
+
+        for (size_t ulIndex = 0; ulIndex < Results.size(); ++ulIndex)
+        {
+            Results[ulIndex].dNsPerOp = std::min(Results[ulIndex].dNsPerOp, PassResults[ulIndex].dNsPerOp);
+        }
+    }
+
+    int iStatus = 0;
+
+    printf("%-32s %12s %12s %9s\n", "case", "ns/op", "baseline", "change");
+
+    for (size_t ulIndex = 0; ulIndex < Results.size(); ++ulIndex)
+    {
+        const BenchmarkResult & rResult = Results[ulIndex];
+        double dChangePercent = 0.0;
+
+        if (!GetChangePercent(rResult, Baseline, dChangePercent))
+        {
+            printf("%-32s %12.4f\n", rResult.strName.c_str(), rResult.dNsPerOp);
+        }
+        else
+        {
+            bool bRegressed = dChangePercent > dTolerancePercent;
+
+            printf("%-32s %12.4f %12.4f %+8.1f%%%s\n", rResult.strName.c_str(), rResult.dNsPerOp,
+                   Baseline.find(rResult.strName)->second, dChangePercent, bRegressed ? "  REGRESSION" : "");
+
+            iStatus = bRegressed ? 1 : iStatus;
+        }
+    }
+
+    if ((pszWriteBaseline != NULL) && !WriteBaseline(pszWriteBaseline, Results))
+    {
+        fprintf(stderr, "Cannot write baseline %s\n", pszWriteBaseline);
+
+        iStatus = 2;
+    }
+
+    return iStatus;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
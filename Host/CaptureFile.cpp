@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file CaptureFile.cpp
+///
+/// @see CaptureFile.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <string.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "CaptureFile.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::CaptureFile
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    CaptureFile::CaptureFile()
+        : m_bWritable(false),
+          m_eLayout(CAPTURE_LAYOUT_RECORDS),
+          m_ulChannelCount(0),
+          m_ullSampleCount(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::Open
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CaptureFile::Open(const char * pszPath)
+    {
+        Close();
+
+        bool bValid = m_File.OpenRead(pszPath) && (m_File.GetSize() >= sizeof(CaptureHeader));
+
+        if (bValid)
+        {
+            CaptureHeader Header;
+
+            memcpy(&Header, m_File.GetData(), sizeof(Header));
+
+            CaptureLayout eLayout = static_cast<CaptureLayout>(Header.uwLayout);
+            uint64_t ullFileSize = GetFileSize(eLayout, Header.ulChannelCount, Header.ullSampleCount);
+
+            bValid = (Header.ulMagic == CAPTURE_MAGIC) &&
+                     (Header.uwVersion == CAPTURE_VERSION) &&
+                     (ullFileSize != 0u) &&
+                     (ullFileSize <= m_File.GetSize());
+
+            if (bValid)
+            {
+                m_eLayout = eLayout;
+                m_ulChannelCount = Header.ulChannelCount;
+                m_ullSampleCount = Header.ullSampleCount;
+            }
+        }
+
+        if (!bValid)
+        {
+            Close();
+        }
+
+        return bValid;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::Create
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CaptureFile::Create(const char * pszPath, CaptureLayout eLayout, uint32_t ulChannelCount,
+                             uint64_t ullSampleCount)
+    {
+        Close();
+
+        uint64_t ullFileSize = GetFileSize(eLayout, ulChannelCount, ullSampleCount);
+
+        // A new file reads as zeros, so only the header needs writing
+        bool bCreated = (ullFileSize != 0u) && m_File.Create(pszPath, ullFileSize);
+
+        if (bCreated)
+        {
+            CaptureHeader Header;
+
+            memset(&Header, 0, sizeof(Header));
+
+            Header.ulMagic = CAPTURE_MAGIC;
+            Header.uwVersion = CAPTURE_VERSION;
+            Header.uwLayout = static_cast<uint16_t>(eLayout);
+            Header.ulChannelCount = ulChannelCount;
+            Header.ullSampleCount = ullSampleCount;
+
+            memcpy(m_File.GetData(), &Header, sizeof(Header));
+
+            m_bWritable = true;
+            m_eLayout = eLayout;
+            m_ulChannelCount = ulChannelCount;
+            m_ullSampleCount = ullSampleCount;
+        }
+
+        return bCreated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::Close
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void CaptureFile::Close(void)
+    {
+        m_File.Close();
+
+        m_bWritable = false;
+        m_eLayout = CAPTURE_LAYOUT_RECORDS;
+        m_ulChannelCount = 0;
+        m_ullSampleCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetRecords
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const CaptureRecord * CaptureFile::GetRecords(void) const
+    {
+        bool bRecords = (m_File.GetData() != 0) && (m_eLayout == CAPTURE_LAYOUT_RECORDS);
+
+        return bRecords ? reinterpret_cast<const CaptureRecord *>(GetSamples()) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetWritableRecords
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    CaptureRecord * CaptureFile::GetWritableRecords(void)
+    {
+        return m_bWritable ? const_cast<CaptureRecord *>(GetRecords()) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetTimestampsUs
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const uint32_t * CaptureFile::GetTimestampsUs(void) const
+    {
+        bool bColumns = (m_File.GetData() != 0) && (m_eLayout == CAPTURE_LAYOUT_COLUMNS);
+
+        return bColumns ? reinterpret_cast<const uint32_t *>(GetSamples()) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetWritableTimestampsUs
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t * CaptureFile::GetWritableTimestampsUs(void)
+    {
+        return m_bWritable ? const_cast<uint32_t *>(GetTimestampsUs()) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetValues
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const float * CaptureFile::GetValues(uint32_t ulChannel) const
+    {
+        bool bColumns = (m_File.GetData() != 0) && (m_eLayout == CAPTURE_LAYOUT_COLUMNS) &&
+                        (ulChannel < m_ulChannelCount);
+
+        // The timestamp column comes first
+        uint64_t ullOffset = GetColumnBytes(m_ullSampleCount) * (1u + static_cast<uint64_t>(ulChannel));
+
+        return bColumns ? reinterpret_cast<const float *>(GetSamples() + ullOffset) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetWritableValues
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    float * CaptureFile::GetWritableValues(uint32_t ulChannel)
+    {
+        return m_bWritable ? const_cast<float *>(GetValues(ulChannel)) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetFileSize
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t CaptureFile::GetFileSize(CaptureLayout eLayout, uint32_t ulChannelCount, uint64_t ullSampleCount)
+    {
+        uint64_t ullFileSize = 0;
+
+        if ((ullSampleCount != 0u) && (ullSampleCount <= MAX_SAMPLE_COUNT))
+        {
+            if ((eLayout == CAPTURE_LAYOUT_RECORDS) && (ulChannelCount == 1u))
+            {
+                ullFileSize = sizeof(CaptureHeader) + (ullSampleCount * sizeof(CaptureRecord));
+            }
+            else if ((eLayout == CAPTURE_LAYOUT_COLUMNS) && (ulChannelCount != 0u))
+            {
+                ullFileSize = sizeof(CaptureHeader) +
+                              (GetColumnBytes(ullSampleCount) * (1u + static_cast<uint64_t>(ulChannelCount)));
+            }
+        }
+
+        return ullFileSize;
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CaptureFile::GetColumnBytes
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t CaptureFile::GetColumnBytes(uint64_t ullSampleCount)
+    {
+        // Timestamps and values are both four bytes
+        uint64_t ullBytes = ullSampleCount * sizeof(float);
+
+        return (ullBytes + (CAPTURE_COLUMN_ALIGNMENT - 1u)) & ~static_cast<uint64_t>(CAPTURE_COLUMN_ALIGNMENT - 1u);
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file CaptureFile.hpp
+///
+/// Description Memory mapped acquisition capture files
+///
+/// @par Full Description
+/// Class header for the CaptureFile class and the binary layout of acquisition capture files.
+///
+/// A capture file is a 64 byte CaptureHeader followed by the samples in one of two layouts, little endian:
+/// - CAPTURE_LAYOUT_RECORDS: one channel as consecutive CaptureRecord (timestamp, value) pairs, the layout the
+///   acquisition nodes archive in.
+/// - CAPTURE_LAYOUT_COLUMNS: any number of channels sampled together, as one column of timestamps followed by one
+///   column of values per channel.  Each column starts on a CAPTURE_COLUMN_ALIGNMENT byte boundary so that it can be
+///   handed straight to the vectorized batch computations.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CAPTURE_FILE_HPP__
+#define __CAPTURE_FILE_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "MappedFile.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+// Sample layouts of a capture file
+enum CaptureLayout
+{
+    CAPTURE_LAYOUT_RECORDS = 0,
+    CAPTURE_LAYOUT_COLUMNS = 1
+};
+
+// "RCAP" read as a little endian word
+static const uint32_t CAPTURE_MAGIC = 0x50414352u;
+static const uint16_t CAPTURE_VERSION = 1u;
+
+// Alignment of the header size and of each column in bytes
+static const uint32_t CAPTURE_COLUMN_ALIGNMENT = 64u;
+
+// Start of a capture file
+struct CaptureHeader
+{
+    uint32_t ulMagic;           ///< CAPTURE_MAGIC
+    uint16_t uwVersion;         ///< CAPTURE_VERSION
+    uint16_t uwLayout;          ///< CaptureLayout of the samples
+    uint32_t ulChannelCount;    ///< Channels, 1 for CAPTURE_LAYOUT_RECORDS
+    uint32_t ulReserved;        ///< Written as 0
+    uint64_t ullSampleCount;    ///< Samples per channel
+    uint8_t  aubReserved[40];   ///< Written as 0
+};
+
+static_assert(sizeof(CaptureHeader) == CAPTURE_COLUMN_ALIGNMENT, "The header is one column alignment unit");
+
+// One sample of a CAPTURE_LAYOUT_RECORDS file
+struct CaptureRecord
+{
+    uint32_t ulTimestampUs;     ///< Free running microsecond timestamp
+    float    fValue;            ///< Sampled value
+};
+
+static_assert(sizeof(CaptureRecord) == 8u, "Capture records are packed");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// CaptureFile: CaptureFile
+///
+/// A capture file mapped into memory
+///
+/// @par Full Description
+/// The sample accessors return pointers straight into the mapping, so reading or writing a capture never copies the
+/// samples.  A file opened with Open is read only and the GetWritable accessors return NULL for it; a file made with
+/// Create is writable and its contents reach the disk through the page cache after Close.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class CaptureFile
+{
+    public:
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CaptureFile::CaptureFile
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CaptureFile();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CaptureFile::~CaptureFile
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CaptureFile() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::Open
+        ///
+        /// @param  [in]  pszPath   Capture file to map read only.
+        ///
+        /// @return whether the file was mapped and has a valid header and size
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Open(const char * pszPath);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::Create
+        ///
+        /// @par Full Description
+        /// Creates a capture file of the given shape with the header written and the samples zeroed.
+        ///
+        /// @param  [in]  pszPath           File to create or truncate.
+        /// @param  [in]  eLayout           Sample layout.
+        /// @param  [in]  ulChannelCount    Channels, 1 for CAPTURE_LAYOUT_RECORDS.
+        /// @param  [in]  ullSampleCount    Samples per channel.
+        ///
+        /// @return whether the file was created and mapped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Create(const char * pszPath, CaptureLayout eLayout, uint32_t ulChannelCount, uint64_t ullSampleCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::Close
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Close(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetLayout
+        ///
+        /// @return sample layout
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CaptureLayout GetLayout(void) const { return m_eLayout; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetChannelCount
+        ///
+        /// @return channels in the capture
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetChannelCount(void) const { return m_ulChannelCount; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetSampleCount
+        ///
+        /// @return samples per channel
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint64_t GetSampleCount(void) const { return m_ullSampleCount; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetRecords
+        ///
+        /// @return the records of a CAPTURE_LAYOUT_RECORDS file, NULL for other layouts
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const CaptureRecord * GetRecords(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetWritableRecords
+        ///
+        /// @return the records of a CAPTURE_LAYOUT_RECORDS file for writing, NULL when the file is read only
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CaptureRecord * GetWritableRecords(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetTimestampsUs
+        ///
+        /// @return the timestamp column of a CAPTURE_LAYOUT_COLUMNS file, NULL for other layouts
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const uint32_t * GetTimestampsUs(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetWritableTimestampsUs
+        ///
+        /// @return the timestamp column of a CAPTURE_LAYOUT_COLUMNS file for writing, NULL when the file is read
+        ///         only
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t * GetWritableTimestampsUs(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetValues
+        ///
+        /// @param  [in]  ulChannel Channel, less than GetChannelCount().
+        ///
+        /// @return the value column of a channel of a CAPTURE_LAYOUT_COLUMNS file, NULL for other layouts
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const float * GetValues(uint32_t ulChannel) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetWritableValues
+        ///
+        /// @param  [in]  ulChannel Channel, less than GetChannelCount().
+        ///
+        /// @return the value column of a channel of a CAPTURE_LAYOUT_COLUMNS file for writing, NULL when the file is
+        ///         read only
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float * GetWritableValues(uint32_t ulChannel);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: CaptureFile::GetFileSize
+        ///
+        /// @return bytes in a capture file of the given shape, 0 when the shape is invalid or too large
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint64_t GetFileSize(CaptureLayout eLayout, uint32_t ulChannelCount, uint64_t ullSampleCount);
+
+    private:
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Largest sample count accepted, keeping every offset well inside 64 bits
+        static const uint64_t MAX_SAMPLE_COUNT = 1ull << 40;
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CaptureFile::GetColumnBytes
+        ///
+        /// Bytes from the start of one column to the next.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint64_t GetColumnBytes(uint64_t ullSampleCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: CaptureFile::GetSamples
+        ///
+        /// Start of the samples in the mapping.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint8_t * GetSamples(void) const { return m_File.GetData() + sizeof(CaptureHeader); }
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        MappedFile    m_File;
+        bool          m_bWritable;
+        CaptureLayout m_eLayout;
+        uint32_t      m_ulChannelCount;
+        uint64_t      m_ullSampleCount;
+
+        // Inhibit copy constructor and assignment operator
+        CaptureFile(CaptureFile &);
+
+        CaptureFile & operator=(CaptureFile const&); // assign op. hidden
+};
+} //Host;
+
+
+#endif //__CAPTURE_FILE_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file CaptureReplay.cpp
+///
+/// @see CaptureReplay.hpp for a detailed description of these functions.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <string.h>
+#include <vector>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "CaptureReplay.hpp"
+#include "RateOfChange.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+namespace
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: ReplayColumns
+    ///
+    /// Replays a CAPTURE_LAYOUT_COLUMNS capture block by block across the channels.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void ReplayColumns(const CaptureFile & rInput, CaptureFile & rOutput)
+    {
+        uint32_t ulChannelCount = rInput.GetChannelCount();
+        uint64_t ullSampleCount = rInput.GetSampleCount();
+        const uint32_t * pulTimestampsUs = rInput.GetTimestampsUs();
+
+        // Each channel carries its previous sample from one block to the next
+        std::vector<SignalChain::RateOfChange> aRates(ulChannelCount);
+
+        memcpy(rOutput.GetWritableTimestampsUs(), pulTimestampsUs, ullSampleCount * sizeof(uint32_t));
+
+        for (uint64_t ullStart = 0; ullStart < ullSampleCount; ullStart += REPLAY_BLOCK_SAMPLES)
+        {
+            uint64_t ullRemaining = ullSampleCount - ullStart;
+            uint32_t ulCount = (ullRemaining < REPLAY_BLOCK_SAMPLES) ? static_cast<uint32_t>(ullRemaining) :
+                                                                       REPLAY_BLOCK_SAMPLES;
+
+            for (uint32_t ulChannel = 0; ulChannel < ulChannelCount; ++ulChannel)
+            {
+                aRates[ulChannel].CalcRateOfChangeUs(rInput.GetValues(ulChannel) + ullStart,
+                                                     pulTimestampsUs + ullStart,
+                                                     rOutput.GetWritableValues(ulChannel) + ullStart,
+                                                     ulCount);
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: ReplayRecords
+    ///
+    /// Replays a CAPTURE_LAYOUT_RECORDS capture sample by sample.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void ReplayRecords(const CaptureFile & rInput, CaptureFile & rOutput)
+    {
+        uint64_t ullSampleCount = rInput.GetSampleCount();
+        const CaptureRecord * pRecords = rInput.GetRecords();
+        uint32_t * pulTimestampsUs = rOutput.GetWritableTimestampsUs();
+        float * pfRates = rOutput.GetWritableValues(0u);
+
+        SignalChain::RateOfChange Rate;
+
+        for (uint64_t ullIndex = 0; ullIndex < ullSampleCount; ++ullIndex)
+        {
+            pulTimestampsUs[ullIndex] = pRecords[ullIndex].ulTimestampUs;
+            pfRates[ullIndex] = Rate.CalcRateOfChangeUs(pRecords[ullIndex].fValue, pRecords[ullIndex].ulTimestampUs);
+        }
+    }
+}
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// ReplayRateOfChange
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool ReplayRateOfChange(const CaptureFile & rInput, CaptureFile & rOutput)
+    {
+        bool bMatches = (rOutput.GetWritableTimestampsUs() != 0) &&
+                        (rOutput.GetChannelCount() == rInput.GetChannelCount()) &&
+                        (rOutput.GetSampleCount() == rInput.GetSampleCount());
+
+        if (bMatches && (rInput.GetLayout() == CAPTURE_LAYOUT_COLUMNS))
+        {
+            ReplayColumns(rInput, rOutput);
+        }
+        else if (bMatches && (rInput.GetLayout() == CAPTURE_LAYOUT_RECORDS))
+        {
+            ReplayRecords(rInput, rOutput);
+        }
+        else
+        {
+            bMatches = false;
+        }
+
+        return bMatches;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// ReplayRateOfChange
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool ReplayRateOfChange(const CaptureFile & rInput, CaptureFile & rOutput, OfflineRateEngine & rEngine)
+    {
+        bool bReplayed = false;
+
+        if (rInput.GetLayout() == CAPTURE_LAYOUT_COLUMNS)
+        {
+            bReplayed = (rOutput.GetWritableTimestampsUs() != 0) &&
+                        (rOutput.GetChannelCount() == rInput.GetChannelCount()) &&
+                        (rOutput.GetSampleCount() == rInput.GetSampleCount());
+
+            if (bReplayed)
+            {
+                uint32_t ulChannelCount = rInput.GetChannelCount();
+                std::vector<OfflineChannel> aChannels(ulChannelCount);
+
+                memcpy(rOutput.GetWritableTimestampsUs(), rInput.GetTimestampsUs(),
+                       rInput.GetSampleCount() * sizeof(uint32_t));
+
+                for (uint32_t ulChannel = 0; ulChannel < ulChannelCount; ++ulChannel)
+                {
+                    aChannels[ulChannel].pfValues = rInput.GetValues(ulChannel);
+                    aChannels[ulChannel].pulTimestampsUs = rInput.GetTimestampsUs();
+                    aChannels[ulChannel].pfRates = rOutput.GetWritableValues(ulChannel);
+                    aChannels[ulChannel].ullSampleCount = rInput.GetSampleCount();
+                }
+
+                rEngine.CalcRateOfChangeUs(aChannels.data(), ulChannelCount);
+            }
+        }
+        else
+        {
+            bReplayed = ReplayRateOfChange(rInput, rOutput);
+        }
+
+        return bReplayed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// ReplayRateOfChange
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool ReplayRateOfChange(const char * pszInputPath, const char * pszOutputPath)
+    {
+        CaptureFile Input;
+        CaptureFile Output;
+
+        return Input.Open(pszInputPath) &&
+               Output.Create(pszOutputPath, CAPTURE_LAYOUT_COLUMNS, Input.GetChannelCount(), Input.GetSampleCount()) &&
+               ReplayRateOfChange(Input, Output);
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file CaptureReplay.hpp
+///
+/// Description Replay of capture files through the rate of change computation
+///
+/// @par Full Description
+/// Replays a mapped capture file through RateOfChange into a mapped output capture.  The output is a
+/// CAPTURE_LAYOUT_COLUMNS capture with the input timestamps and one column of rates per input channel, in units per
+/// microsecond.  Samples are read from and rates written to the mappings in place, so a replay makes no copies of
+/// the data and runs at the speed the page cache can supply it.
+///
+/// Column captures are processed in blocks of REPLAY_BLOCK_SAMPLES with the vectorized batch computation, block by
+/// block across all channels so the timestamps of a block stay in cache while every channel uses them.  Record
+/// captures interleave timestamps and values, so they are streamed through the per sample computation instead.
+///
+/// Given an OfflineRateEngine, column captures are instead computed in parallel on its pool, with results
+/// bit-identical to the serial replay.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added parallel replay through OfflineRateEngine
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __CAPTURE_REPLAY_HPP__
+#define __CAPTURE_REPLAY_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "CaptureFile.hpp"
+#include "OfflineRateEngine.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+// Samples per channel processed in one batch
+static const uint32_t REPLAY_BLOCK_SAMPLES = 16384u;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FUNCTION NAME: ReplayRateOfChange
+///
+/// @par Full Description
+/// Computes the rate of change of every channel of an open capture into a created output capture.
+///
+/// @param  [in]  rInput    Capture opened for reading.
+/// @param  [out] rOutput   Capture created with CAPTURE_LAYOUT_COLUMNS and the channel and sample counts of rInput.
+///
+/// @return whether the replay was done
+/// @retval true:  rOutput holds the input timestamps and the rates
+/// @retval false: the output is not writable or does not match the input
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ReplayRateOfChange(const CaptureFile & rInput, CaptureFile & rOutput);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FUNCTION NAME: ReplayRateOfChange
+///
+/// @par Full Description
+/// Parallel form of the replay.  Column captures are computed by rEngine across its pool, record captures are
+/// replayed serially as above.
+///
+/// @param  [in]  rInput    Capture opened for reading.
+/// @param  [out] rOutput   Capture created with CAPTURE_LAYOUT_COLUMNS and the channel and sample counts of rInput.
+/// @param  [in]  rEngine   Engine computing the column captures.
+///
+/// @return whether the replay was done
+/// @retval true:  rOutput holds the input timestamps and the rates
+/// @retval false: the output is not writable or does not match the input
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ReplayRateOfChange(const CaptureFile & rInput, CaptureFile & rOutput, OfflineRateEngine & rEngine);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FUNCTION NAME: ReplayRateOfChange
+///
+/// @par Full Description
+/// Opens a capture file, creates an output capture file of the matching shape and replays the one into the other.
+///
+/// @param  [in]  pszInputPath    Capture file to replay.
+/// @param  [in]  pszOutputPath   Rate capture file to create.
+///
+/// @return whether the files could be opened and created and the replay was done
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool ReplayRateOfChange(const char * pszInputPath, const char * pszOutputPath);
+
+} //Host;
+
+
+#endif //__CAPTURE_REPLAY_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file CaptureReplayTool.cpp
+///
+/// Description Command line capture replay
+///
+/// @par Full Description
+/// Replays a capture file through the rate of change computation, or generates a synthetic capture to replay.
+///
+/// Usage: CaptureReplay [--threads N] INPUT OUTPUT
+///        CaptureReplay --generate FILE [--records] [--channels N] [--samples N]
+///
+/// Replaying prints the time taken and the throughput in megabytes of capture per second.  Column captures are
+/// replayed on a work stealing pool of --threads workers, one per host core by default.  Generated captures hold
+/// noisy sine waves sampled every millisecond with jitter, from a fixed seed, with timestamps that start just before
+/// the 32 bit microsecond counter overflows.  --records writes a single channel record capture, otherwise a column
+/// capture is written.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added parallel replay with --threads
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "CaptureFile.hpp"
+#include "CaptureReplay.hpp"
+#include "OfflineRateEngine.hpp"
+#include "WorkStealingPool.hpp"
+
+namespace
+{
+    // Fixed generator seed so generated captures are reproducible
+    const uint32_t CAPTURE_SEED = 0xCA97u;
+
+    // Nominal sample period of generated captures
+    const uint32_t SAMPLE_PERIOD_US = 1000u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: Generate
+    ///
+    /// @param  [in]  pszPath           Capture file to write.
+    /// @param  [in]  eLayout           Sample layout.
+    /// @param  [in]  ulChannelCount    Channels.
+    /// @param  [in]  ullSampleCount    Samples per channel.
+    ///
+    /// @return whether the capture was written
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool Generate(const char * pszPath, Host::CaptureLayout eLayout, uint32_t ulChannelCount, uint64_t ullSampleCount)
+    {
+        Host::CaptureFile Capture;
+        std::mt19937 Generator(CAPTURE_SEED);
+
+        bool bCreated = Capture.Create(pszPath, eLayout, ulChannelCount, ullSampleCount);
+
+        if (bCreated)
+        {
+            uint32_t ulTimestampUs = 0xFFFFFFFFu - SAMPLE_PERIOD_US * 1000u;
+
+            for (uint64_t ullIndex = 0; ullIndex < ullSampleCount; ++ullIndex)
+            {
+                // +/- 32 us of jitter
+                ulTimestampUs += SAMPLE_PERIOD_US + (Generator() & 63u) - 32u;
+
+                for (uint32_t ulChannel = 0; ulChannel < ulChannelCount; ++ulChannel)
+                {
+                    float fPhase = static_cast<float>(ullIndex % 100000u) * 0.001f * static_cast<float>(ulChannel + 1u);
+                    float fNoise = static_cast<float>(Generator() & 0xFFFFu) * (1.0f / 65536.0f) - 0.5f;
+                    float fValue = (100.0f * sinf(fPhase)) + fNoise;
+
+                    if (eLayout == Host::CAPTURE_LAYOUT_RECORDS)
+                    {
+                        Host::CaptureRecord & rRecord = Capture.GetWritableRecords()[ullIndex];
+
+                        rRecord.ulTimestampUs = ulTimestampUs;
+                        rRecord.fValue = fValue;
+                    }
+                    else
+                    {
+                        Capture.GetWritableValues(ulChannel)[ullIndex] = fValue;
+                    }
+                }
+
+                if (eLayout == Host::CAPTURE_LAYOUT_COLUMNS)
+                {
+                    Capture.GetWritableTimestampsUs()[ullIndex] = ulTimestampUs;
+                }
+            }
+        }
+
+        return bCreated;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: Replay
+    ///
+    /// @param  [in]  pszInputPath    Capture file to replay.
+    /// @param  [in]  pszOutputPath   Rate capture file to create.
+    /// @param  [in]  ulThreadCount   Workers replaying column captures, 0 for one per host core.
+    ///
+    /// @return whether the replay was done
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool Replay(const char * pszInputPath, const char * pszOutputPath, uint32_t ulThreadCount)
+    {
+        Host::CaptureFile Input;
+        Host::CaptureFile Output;
+        Host::WorkStealingPool Pool(ulThreadCount);
+        Host::OfflineRateEngine Engine(Pool);
+
+        std::chrono::steady_clock::time_point Start = std::chrono::steady_clock::now();
+
+        bool bReplayed = Input.Open(pszInputPath) &&
+                         Output.Create(pszOutputPath, Host::CAPTURE_LAYOUT_COLUMNS, Input.GetChannelCount(),
+                                       Input.GetSampleCount()) &&
+                         Host::ReplayRateOfChange(Input, Output, Engine);
+
+        if (bReplayed)
+        {
+            Output.Close();
+
+            double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+            double dMegabytes = static_cast<double>(Host::CaptureFile::GetFileSize(Input.GetLayout(),
+                                                                                   Input.GetChannelCount(),
+                                                                                   Input.GetSampleCount())) / 1.0e6;
+
+            printf("%u channels x %llu samples on %u threads in %.3f s, %.1f MB/s\n", Input.GetChannelCount(),
+                   static_cast<unsigned long long>(Input.GetSampleCount()), Pool.GetWorkerCount(), dSeconds,
+                   dMegabytes / dSeconds);
+        }
+
+        return bReplayed;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FUNCTION NAME: main
+///
+/// @return 0 on success, 1 on a file error, 2 on a usage error
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char * argv[])
+{
+    const char * pszGenerate = NULL;
+    Host::CaptureLayout eLayout = Host::CAPTURE_LAYOUT_COLUMNS;
+    uint32_t ulChannelCount = 1u;
+    uint64_t ullSampleCount = 1000000u;
+    uint32_t ulThreadCount = 0u;
+    const char * apszPaths[2] = { NULL, NULL };
+    int iPathCount = 0;
+    bool bUsage = true;
+
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        bool bHasValue = (iArg + 1) < argc;
+
+        if ((strcmp(argv[iArg], "--generate") == 0) && bHasValue)
+        {
+            pszGenerate = argv[++iArg];
+        }
+        else if (strcmp(argv[iArg], "--records") == 0)
+        {
+            eLayout = Host::CAPTURE_LAYOUT_RECORDS;
+        }
+        else if ((strcmp(argv[iArg], "--channels") == 0) && bHasValue)
+        {
+            ulChannelCount = static_cast<uint32_t>(strtoul(argv[++iArg], NULL, 0));
+        }
+        else if ((strcmp(argv[iArg], "--samples") == 0) && bHasValue)
+        {
+            ullSampleCount = strtoull(argv[++iArg], NULL, 0);
+        }
+        else if ((strcmp(argv[iArg], "--threads") == 0) && bHasValue)
+        {
+            ulThreadCount = static_cast<uint32_t>(strtoul(argv[++iArg], NULL, 0));
+        }
+        else if ((argv[iArg][0] != '-') && (iPathCount < 2))
+        {
+            apszPaths[iPathCount++] = argv[iArg];
+        }
+        else
+        {
+            iPathCount = -1;
+            break;
+        }
+    }
+
+    int iStatus = 0;
+
+    if ((pszGenerate != NULL) && (iPathCount == 0))
+    {
+        bUsage = false;
+        iStatus = Generate(pszGenerate, eLayout, ulChannelCount, ullSampleCount) ? 0 : 1;
+    }
+    else if ((pszGenerate == NULL) && (iPathCount == 2))
+    {
+        bUsage = false;
+        iStatus = Replay(apszPaths[0], apszPaths[1], ulThreadCount) ? 0 : 1;
+    }
+
+    if (bUsage)
+    {
+        fprintf(stderr, "Usage: %s [--threads N] INPUT OUTPUT\n"
+                        "       %s --generate FILE [--records] [--channels N] [--samples N]\n", argv[0], argv[0]);
+
+        iStatus = 2;
+    }
+    else if (iStatus != 0)
+    {
+        fprintf(stderr, "Capture %s failed\n", (pszGenerate != NULL) ? "generation" : "replay");
+    }
+
+    return iStatus;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file IWdtSimulator.cpp
+///
+/// @see IWdtSimulator.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+#include "Registers.h"
+
+// C++ PROJECT INCLUDES
+#include "IWdtSimulator.hpp"
+
+// Backing store for REG_ADDRESS_IWDT.  The proxies carry no state of their own.
+RegMapIWdt g_HostRegMapIWdt;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// IWdtRefreshRegister::operator=
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+IWdtRefreshRegister & IWdtRefreshRegister::operator=(uint8_t ubValue)
+{
+    Host::IWdtSimulator::GetInstance().WriteRefresh(ubValue);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// IWdtRefreshRegister::operator uint8_t
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+IWdtRefreshRegister::operator uint8_t() const
+{
+    // The refresh register always reads back as 0xFF
+    return 0xFFu;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// IWdtStatusRegister::operator=
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+IWdtStatusRegister & IWdtStatusRegister::operator=(uint16_t uwValue)
+{
+    Host::IWdtSimulator::GetInstance().WriteStatus(uwValue);
+
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// IWdtStatusRegister::operator uint16_t
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+IWdtStatusRegister::operator uint16_t() const
+{
+    return Host::IWdtSimulator::GetInstance().ReadStatus();
+}
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::GetInstance
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    IWdtSimulator & IWdtSimulator::GetInstance(void)
+    {
+        static IWdtSimulator s_Simulator;
+
+        return s_Simulator;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::PowerOn
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void IWdtSimulator::PowerOn(const CpfBsp::WatchdogWindow & rWindow)
+    {
+        m_Window = rWindow;
+        m_Window.ulTimeoutUs = (rWindow.ulTimeoutUs != 0u) ? rWindow.ulTimeoutUs : 1u;
+
+        m_ullTimeUs = 0;
+        m_ullCycleStartUs = 0;
+        m_bRefreshArmed = false;
+        m_uwFlags = 0;
+        m_ulRefreshCount = 0;
+        m_ulSequenceErrorCount = 0;
+        m_ulResetCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::AdvanceUs
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void IWdtSimulator::AdvanceUs(uint32_t ulUs)
+    {
+        m_ullTimeUs += ulUs;
+
+        while ((m_ullTimeUs - m_ullCycleStartUs) >= m_Window.ulTimeoutUs)
+        {
+            ResetMcu(STATUS_UNDERFLOW, m_ullCycleStartUs + m_Window.ulTimeoutUs);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::WriteRefresh
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void IWdtSimulator::WriteRefresh(uint8_t ubValue)
+    {
+        if (ubValue == FIRST_REFRESH_BYTE)
+        {
+            m_bRefreshArmed = true;
+        }
+        else if ((ubValue == SECOND_REFRESH_BYTE) && m_bRefreshArmed)
+        {
+            m_bRefreshArmed = false;
+
+            uint64_t ullElapsedUs = m_ullTimeUs - m_ullCycleStartUs;
+
+            if ((ullElapsedUs >= m_Window.GetOpenUs()) && (ullElapsedUs <= m_Window.GetCloseUs()))
+            {
+                m_ullCycleStartUs = m_ullTimeUs;
+
+                ++m_ulRefreshCount;
+            }
+            else
+            {
+                ResetMcu(STATUS_REFRESH_ERROR, m_ullTimeUs);
+            }
+        }
+        else
+        {
+            m_bRefreshArmed = false;
+
+            ++m_ulSequenceErrorCount;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::ReadStatus
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint16_t IWdtSimulator::ReadStatus(void) const
+    {
+        // The hardware counter counts down from full scale to underflow over one timer cycle
+        uint64_t ullRemainingUs = m_Window.ulTimeoutUs - (m_ullTimeUs - m_ullCycleStartUs);
+        uint16_t uwCounter = static_cast<uint16_t>((ullRemainingUs * STATUS_COUNTER_MASK) / m_Window.ulTimeoutUs);
+
+        return static_cast<uint16_t>(m_uwFlags | uwCounter);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::WriteStatus
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void IWdtSimulator::WriteStatus(uint16_t uwValue)
+    {
+        m_uwFlags &= uwValue;
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::IWdtSimulator
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    IWdtSimulator::IWdtSimulator()
+    {
+        CpfBsp::WatchdogWindow DefaultWindow = { 2000000u, CpfBsp::WINDOW_START_0, CpfBsp::WINDOW_END_100 };
+
+        PowerOn(DefaultWindow);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// IWdtSimulator::ResetMcu
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void IWdtSimulator::ResetMcu(uint16_t uwFlag, uint64_t ullCycleStartUs)
+    {
+        m_uwFlags |= uwFlag;
+        m_ullCycleStartUs = ullCycleStartUs;
+        m_bRefreshArmed = false;
+
+        ++m_ulResetCount;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
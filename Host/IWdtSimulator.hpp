@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file IWdtSimulator.hpp
+///
+/// Description Host simulation of the independent watchdog timer
+///
+/// @par Full Description
+/// Class header for the IWdtSimulator class, which stands in for the IWDT peripheral when the board support code is
+/// built for a Linux host.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __IWDT_SIMULATOR_HPP__
+#define __IWDT_SIMULATOR_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "WatchdogWindow.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IWdtSimulator: IWdtSimulator
+///
+/// Simulated independent watchdog timer
+///
+/// @par Full Description
+/// The simulated Registers.h routes the IWDT refresh and status registers here.  Time is simulated and only moves
+/// when AdvanceUs is called, so runs are reproducible.  The simulation follows the hardware:
+/// - a refresh is a write of 0x00 followed by a write of 0xFF to the refresh register; anything else is a sequence
+///   error and does not refresh,
+/// - a refresh outside the configured window sets the refresh error flag and resets the MCU,
+/// - a timer cycle with no refresh sets the underflow flag and resets the MCU,
+/// - the status register holds the counter in its low 14 bits and the flags in bits 14 and 15, which survive the
+///   reset and are cleared by writing 0 to them.
+/// A reset restarts the timer cycle and is counted, since the host process itself carries on.
+///
+/// The default configuration is a 2 second timeout with the window fully open.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class IWdtSimulator
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Status register fields
+        static const uint16_t STATUS_COUNTER_MASK  = 0x3FFFu;
+        static const uint16_t STATUS_UNDERFLOW     = 0x4000u;   ///< UNDFF, the counter underflowed
+        static const uint16_t STATUS_REFRESH_ERROR = 0x8000u;   ///< REFEF, refreshed outside the window
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::GetInstance
+        ///
+        /// @return the simulated IWDT behind REG_ADDRESS_IWDT
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static IWdtSimulator & GetInstance(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::PowerOn
+        ///
+        /// @par Full Description
+        /// Applies an OFS0 configuration and simulates a power on reset, clearing the flags and counts.
+        ///
+        /// @param  [in]  rWindow   Timeout and refresh window, as programmed in OFS0.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void PowerOn(const CpfBsp::WatchdogWindow & rWindow);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::AdvanceUs
+        ///
+        /// @par Full Description
+        /// Moves simulated time forward, resetting the MCU for every timer cycle that expires.
+        ///
+        /// @param  [in]  ulUs      Microseconds to advance.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void AdvanceUs(uint32_t ulUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::GetTimeUs
+        ///
+        /// @return simulated microseconds since PowerOn
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint64_t GetTimeUs(void) const { return m_ullTimeUs; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::WriteRefresh
+        ///
+        /// @param  [in]  ubValue   Value written to the refresh register.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void WriteRefresh(uint8_t ubValue);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::ReadStatus
+        ///
+        /// @return the status register, the counter value and the flags
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint16_t ReadStatus(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::WriteStatus
+        ///
+        /// @param  [in]  uwValue   Value written to the status register.  Flags written as 0 are cleared.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void WriteStatus(uint16_t uwValue);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::GetRefreshCount
+        ///
+        /// @return successful refreshes since PowerOn
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetRefreshCount(void) const { return m_ulRefreshCount; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::GetSequenceErrorCount
+        ///
+        /// @return refresh register writes out of sequence since PowerOn
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetSequenceErrorCount(void) const { return m_ulSequenceErrorCount; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: IWdtSimulator::GetResetCount
+        ///
+        /// @return simulated watchdog resets since PowerOn
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetResetCount(void) const { return m_ulResetCount; }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: IWdtSimulator::IWdtSimulator
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        IWdtSimulator();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: IWdtSimulator::ResetMcu
+        ///
+        /// Records a watchdog reset with the given status flag and restarts the timer cycle at ullCycleStartUs.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void ResetMcu(uint16_t uwFlag, uint64_t ullCycleStartUs);
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Refresh sequence bytes
+        static const uint8_t FIRST_REFRESH_BYTE  = 0x00u;
+        static const uint8_t SECOND_REFRESH_BYTE = 0xFFu;
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        CpfBsp::WatchdogWindow m_Window;
+
+        // Simulated time and the start of the current timer cycle
+        uint64_t               m_ullTimeUs;
+        uint64_t               m_ullCycleStartUs;
+
+        // First refresh byte written, waiting for the second
+        bool                   m_bRefreshArmed;
+
+        // Status flags
+        uint16_t               m_uwFlags;
+
+        uint32_t               m_ulRefreshCount;
+        uint32_t               m_ulSequenceErrorCount;
+        uint32_t               m_ulResetCount;
+
+        // Inhibit copy constructor and assignment operator
+        IWdtSimulator(IWdtSimulator &);
+
+        IWdtSimulator & operator=(IWdtSimulator const&); // assign op. hidden
+};
+} //Host;
+
+
+#endif //__IWDT_SIMULATOR_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
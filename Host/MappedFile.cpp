@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file MappedFile.cpp
+///
+/// @see MappedFile.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added OpenReadWrite for persistent state
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "MappedFile.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// MappedFile::MappedFile
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    MappedFile::MappedFile() : m_pubData(0), m_ullSize(0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// MappedFile::OpenRead
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool MappedFile::OpenRead(const char * pszPath)
+    {
+        Close();
+
+        int iFile = open(pszPath, O_RDONLY);
+        struct stat Status;
+
+        bool bMapped = (iFile >= 0) && (fstat(iFile, &Status) == 0) && Map(iFile, Status.st_size, false);
+
+        if (bMapped)
+        {
+            // Replay reads each mapping front to back, so let the kernel read well ahead
+            madvise(m_pubData, m_ullSize, MADV_SEQUENTIAL);
+        }
+        else if (iFile >= 0)
+        {
+            close(iFile);
+        }
+
+        return bMapped;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// MappedFile::Create
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool MappedFile::Create(const char * pszPath, uint64_t ullSize)
+    {
+        Close();
+
+        int iFile = open(pszPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+        bool bMapped = (iFile >= 0) && (ftruncate(iFile, static_cast<off_t>(ullSize)) == 0) &&
+                       Map(iFile, ullSize, true);
+
+        if (!bMapped && (iFile >= 0))
+        {
+            close(iFile);
+        }
+
+        return bMapped;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// MappedFile::OpenReadWrite
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool MappedFile::OpenReadWrite(const char * pszPath, uint64_t ullSize)
+    {
+        Close();
+
+        int iFile = open(pszPath, O_RDWR | O_CREAT, 0644);
+        struct stat Status;
+
+        bool bMapped = (iFile >= 0) && (fstat(iFile, &Status) == 0) &&
+                       ((static_cast<uint64_t>(Status.st_size) >= ullSize) ||
+                        (ftruncate(iFile, static_cast<off_t>(ullSize)) == 0)) &&
+                       Map(iFile, ullSize, true);
+
+        if (!bMapped && (iFile >= 0))
+        {
+            close(iFile);
+        }
+
+        return bMapped;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// MappedFile::Close
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void MappedFile::Close(void)
+    {
+        if (m_pubData != 0)
+        {
+            munmap(m_pubData, m_ullSize);
+
+            m_pubData = 0;
+            m_ullSize = 0;
+        }
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// MappedFile::Map
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool MappedFile::Map(int iFile, uint64_t ullSize, bool bWritable)
+    {
+        bool bMapped = false;
+
+        // An empty file cannot be mapped, and is never a valid capture anyway
+        if (ullSize != 0u)
+        {
+            void * pData = mmap(0, ullSize, bWritable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, iFile, 0);
+
+            if (pData != MAP_FAILED)
+            {
+                m_pubData = static_cast<uint8_t *>(pData);
+                m_ullSize = ullSize;
+
+                close(iFile);
+
+                bMapped = true;
+            }
+        }
+
+        return bMapped;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file MappedFile.hpp
+///
+/// Description Memory mapped file
+///
+/// @par Full Description
+/// Class header for the MappedFile class, a file mapped into memory for the life of the object.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added OpenReadWrite for persistent state
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __MAPPED_FILE_HPP__
+#define __MAPPED_FILE_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// MappedFile: MappedFile
+///
+/// A whole file mapped into the address space
+///
+/// @par Full Description
+/// The mapping is released by Close or the destructor.  Files opened for reading are mapped read only and advised
+/// for sequential access so the kernel reads ahead.  Created files are mapped shared, so stores to the mapping are
+/// written back to the file by the page cache without any explicit I/O.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class MappedFile
+{
+    public:
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MappedFile::MappedFile
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MappedFile::~MappedFile
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MappedFile() { Close(); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: MappedFile::OpenRead
+        ///
+        /// @param  [in]  pszPath   File to map read only.
+        ///
+        /// @return whether the file was mapped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool OpenRead(const char * pszPath);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: MappedFile::Create
+        ///
+        /// @param  [in]  pszPath   File to create or truncate, and map read write.
+        /// @param  [in]  ullSize   Size of the file in bytes.
+        ///
+        /// @return whether the file was created and mapped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Create(const char * pszPath, uint64_t ullSize);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: MappedFile::OpenReadWrite
+        ///
+        /// @par Full Description
+        /// Maps a file read write keeping its contents, for state that must outlive the process.  A missing file is
+        /// created and a short one extended, with zeros.
+        ///
+        /// @param  [in]  pszPath   File to open or create.
+        /// @param  [in]  ullSize   Bytes to map from the start of the file.
+        ///
+        /// @return whether the file was opened and mapped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool OpenReadWrite(const char * pszPath, uint64_t ullSize);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: MappedFile::Close
+        ///
+        /// @par Full Description
+        /// Unmaps the file.  Closing a file that is not mapped has no effect.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Close(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: MappedFile::GetData
+        ///
+        /// @return start of the mapping, NULL when nothing is mapped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint8_t * GetData(void) const { return m_pubData; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: MappedFile::GetSize
+        ///
+        /// @return size of the mapping in bytes
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint64_t GetSize(void) const { return m_ullSize; }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MappedFile::Map
+        ///
+        /// Maps an open file descriptor and closes it, the mapping keeps the file referenced.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Map(int iFile, uint64_t ullSize, bool bWritable);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        uint8_t * m_pubData;
+        uint64_t  m_ullSize;
+
+        // Inhibit copy constructor and assignment operator
+        MappedFile(MappedFile &);
+
+        MappedFile & operator=(MappedFile const&); // assign op. hidden
+};
+} //Host;
+
+
+#endif //__MAPPED_FILE_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
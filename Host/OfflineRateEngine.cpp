@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file OfflineRateEngine.cpp
+///
+/// @see OfflineRateEngine.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "OfflineRateEngine.hpp"
+#include "RateOfChange.hpp"
+#include "RateOfChangeKernel.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// OfflineRateEngine::OfflineRateEngine
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    OfflineRateEngine::OfflineRateEngine(WorkStealingPool & rPool, uint32_t ulChunkSamples)
+        : m_rPool(rPool),
+          m_ulChunkSamples((ulChunkSamples != 0u) ? ulChunkSamples : DEFAULT_CHUNK_SAMPLES),
+          m_pChannels(0),
+          m_aChunks()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// OfflineRateEngine::CalcRateOfChangeUs
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void OfflineRateEngine::CalcRateOfChangeUs(const OfflineChannel * pChannels, uint32_t ulChannelCount)
+    {
+        m_pChannels = pChannels;
+        m_aChunks.clear();
+
+        for (uint32_t ulChannel = 0; ulChannel < ulChannelCount; ++ulChannel)
+        {
+            uint64_t ullSampleCount = pChannels[ulChannel].ullSampleCount;
+
+            for (uint64_t ullStart = 0; ullStart < ullSampleCount; ullStart += m_ulChunkSamples)
+            {
+                uint64_t ullRemaining = ullSampleCount - ullStart;
+                Chunk NewChunk;
+
+                NewChunk.ulChannel = ulChannel;
+                NewChunk.ulCount = (ullRemaining < m_ulChunkSamples) ? static_cast<uint32_t>(ullRemaining) :
+                                                                       m_ulChunkSamples;
+                NewChunk.ullStart = ullStart;
+
+                m_aChunks.push_back(NewChunk);
+            }
+        }
+
+        m_rPool.Run(&OfflineRateEngine::RunChunk, this, static_cast<uint32_t>(m_aChunks.size()));
+
+        m_pChannels = 0;
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// OfflineRateEngine::RunChunk
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void OfflineRateEngine::RunChunk(void * pContext, uint32_t ulChunk)
+    {
+        const OfflineRateEngine * pEngine = static_cast<const OfflineRateEngine *>(pContext);
+        const Chunk & rChunk = pEngine->m_aChunks[ulChunk];
+        const OfflineChannel & rChannel = pEngine->m_pChannels[rChunk.ulChannel];
+
+        const float * pfValues = rChannel.pfValues + rChunk.ullStart;
+        const uint32_t * pulTimestampsUs = rChannel.pulTimestampsUs + rChunk.ullStart;
+        float * pfRates = rChannel.pfRates + rChunk.ullStart;
+
+        if (rChunk.ullStart == 0u)
+        {
+            // Starts the channel, exactly as a serial computation would
+            SignalChain::RateOfChange Rate;
+
+            Rate.CalcRateOfChangeUs(pfValues, pulTimestampsUs, pfRates, rChunk.ulCount);
+        }
+        else
+        {
+            // Stitched onto the previous chunk through the sample before it
+            SignalChain::Kernel::CalcRatesUs(pfValues, pfValues - 1, pulTimestampsUs, pulTimestampsUs - 1, pfRates,
+                                             rChunk.ulCount);
+        }
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file OfflineRateEngine.hpp
+///
+/// Description Parallel offline rate of change computation
+///
+/// @par Full Description
+/// Class header for the OfflineRateEngine class, which computes the rates of change of many recorded channels
+/// across the cores of a WorkStealingPool.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OFFLINE_RATE_ENGINE_HPP__
+#define __OFFLINE_RATE_ENGINE_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <vector>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "WorkStealingPool.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+// One recorded channel and where its rates go
+struct OfflineChannel
+{
+    const float *    pfValues;          ///< Sampled values
+    const uint32_t * pulTimestampsUs;   ///< Sample timestamps in microseconds, may be shared between channels
+    float *          pfRates;           ///< Rates of change in units per microsecond, not overlapping the inputs
+    uint64_t         ullSampleCount;    ///< Samples in the channel
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OfflineRateEngine: OfflineRateEngine
+///
+/// Computes the rates of change of recorded channels in parallel
+///
+/// @par Full Description
+/// Every channel is cut into chunks of at most GetChunkSamples() samples and the chunks are run as tasks on the
+/// pool, so thousands of short channels and a single channel of several hours both spread over every core.  Chunks
+/// are numbered channel by channel, so the range of tasks each worker starts with covers neighbouring chunks.
+///
+/// A chunk needs the sample before it as its previous sample.  Offline that sample is already in memory, so a chunk
+/// starting part way into a channel is differenced against it directly and the chunks are independent of each
+/// other.  The first chunk of a channel starts with no previous sample and gives a rate of 0 for its first sample,
+/// as a new RateOfChange does.  Each rate therefore comes from the same two samples and the same vectorized kernel
+/// whatever the chunk size or the order the chunks run in, and the results are bit-identical to a serial batch
+/// RateOfChange::CalcRateOfChangeUs over the whole channel.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class OfflineRateEngine
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Default chunk size, one megabyte of each column, large enough to hide the task overhead
+        static const uint32_t DEFAULT_CHUNK_SAMPLES = 1u << 18;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: OfflineRateEngine::OfflineRateEngine
+        ///
+        /// @par Full Description
+        /// Constructor
+        ///
+        /// @param  [in]  rPool             Pool to run the chunks on.
+        /// @param  [in]  ulChunkSamples    Largest chunk in samples, 0 for DEFAULT_CHUNK_SAMPLES.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit OfflineRateEngine(WorkStealingPool & rPool, uint32_t ulChunkSamples = DEFAULT_CHUNK_SAMPLES);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: OfflineRateEngine::~OfflineRateEngine
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~OfflineRateEngine() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: OfflineRateEngine::CalcRateOfChangeUs
+        ///
+        /// @par Full Description
+        /// Computes the rate of change of every sample of every channel in units per microsecond.
+        ///
+        /// @pre    No channel's rates overlap any channel's values or timestamps, or another channel's rates.
+        /// @post   Every channel's rates written.
+        ///
+        /// @param  [in]  pChannels         Channels to compute.
+        /// @param  [in]  ulChannelCount    Number of channels.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CalcRateOfChangeUs(const OfflineChannel * pChannels, uint32_t ulChannelCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: OfflineRateEngine::GetChunkSamples
+        ///
+        /// @return largest chunk in samples
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetChunkSamples(void) const { return m_ulChunkSamples; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: OfflineRateEngine::GetPool
+        ///
+        /// @return pool the chunks run on
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WorkStealingPool & GetPool(void) const { return m_rPool; }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Samples of one channel computed by one task
+        struct Chunk
+        {
+            uint32_t ulChannel;
+            uint32_t ulCount;
+            uint64_t ullStart;
+        };
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: OfflineRateEngine::RunChunk
+        ///
+        /// Pool task computing one chunk.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void RunChunk(void * pContext, uint32_t ulChunk);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        WorkStealingPool &     m_rPool;
+        uint32_t               m_ulChunkSamples;
+
+        // Work of the call in progress
+        const OfflineChannel * m_pChannels;
+        std::vector<Chunk>     m_aChunks;
+
+        // Inhibit copy constructor and assignment operator
+        OfflineRateEngine(OfflineRateEngine &);
+
+        OfflineRateEngine & operator=(OfflineRateEngine const&); // assign op. hidden
+};
+} //Host;
+
+
+#endif //__OFFLINE_RATE_ENGINE_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file Registers.h
+///
+/// Description Host build register map
+///
+/// @par Full Description
+/// Replaces the Renesas Synergy register definitions when building for a Linux host.  Only the peripherals used by
+/// the board support code are defined.  Each register is a small proxy object whose reads and writes are forwarded
+/// to a simulation of the peripheral, so the driver code compiles unchanged against REG_ADDRESS_*.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __REGISTERS_H__
+#define __REGISTERS_H__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+// IWDT refresh register (IWDTRR), forwarded to Host::IWdtSimulator
+struct IWdtRefreshRegister
+{
+    IWdtRefreshRegister & operator=(uint8_t ubValue);
+    operator uint8_t() const;
+};
+
+// IWDT status register (IWDTSR), forwarded to Host::IWdtSimulator
+struct IWdtStatusRegister
+{
+    IWdtStatusRegister & operator=(uint16_t uwValue);
+    operator uint16_t() const;
+};
+
+// Independent watchdog timer registers
+typedef struct
+{
+    IWdtRefreshRegister ubRefresh;
+    IWdtStatusRegister  uwStatus;
+} RegMapIWdt;
+
+// Backing store for REG_ADDRESS_IWDT
+extern RegMapIWdt g_HostRegMapIWdt;
+
+#define REG_ADDRESS_IWDT (&g_HostRegMapIWdt)
+
+#endif //__REGISTERS_H__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
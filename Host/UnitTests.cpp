@@ -0,0 +1,2305 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file UnitTests.cpp
+///
+/// Description Host behaviour checks of the watchdog and signal chain modules, run by ctest
+///
+/// @par Full Description
+/// Checks what the modules promise rather than how fast they do it, which is left to Benchmark.  Each group of
+/// checks covers one module, against a plain reference where there is one: a batch or vectorized path against the
+/// scalar code it stands in for, running sums against a direct calculation, or the watchdog against the simulated
+/// IWDT.
+///
+/// Usage: UnitTests [GROUP...]
+///   Runs the named groups of checks, or every group with no arguments.  Each failed check is reported on stderr.
+///
+/// Kernels vectorized at compile time only have their vector code checked in a build configured with WATCHDOG_NATIVE.
+///
+/// FloatLib chooses its vector code at run time, so the default build checks it against the scalar code on any
+/// AVX2 host.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added the RateOfChangeBank checks
+/// - agent 16-Oct-2026 Added the batch RateOfChange checks
+/// - agent 16-Oct-2026 Added the RateOfChange output unit checks
+/// - agent 16-Oct-2026 Added the FloatLib array kernel checks
+/// - agent 16-Oct-2026 Added the scalar FloatLib classification checks
+/// - agent 16-Oct-2026 Added the LeastSquaresSlope checks
+/// - agent 16-Oct-2026 Added the SampleRing checks
+/// - agent 16-Oct-2026 Added the WatchdogSupervisor checks
+/// - agent 16-Oct-2026 Added the KickScheduler checks
+/// - agent 16-Oct-2026 Added the LatencyHistogram and WatchdogMonitor checks
+/// - agent 16-Oct-2026 Added the CaptureFile checks
+/// - agent 16-Oct-2026 Added the OfflineRateEngine checks
+/// - agent 16-Oct-2026 Added the RateAlarmBank checks
+/// - agent 16-Oct-2026 Added the SignalPipeline checks
+/// - agent 16-Oct-2026 Added the MultiHorizonRateOfChange checks
+/// - agent 16-Oct-2026 Added the SampleScrubber checks
+/// - agent 16-Oct-2026 Added the WatchdogTrace checks
+/// - agent 16-Oct-2026 Added the WatchdogPolicy and PeriodicKicker checks
+/// - agent 16-Oct-2026 Added the ChannelRegistry checks
+/// - agent 16-Oct-2026 Added the Float16 and BFloat16 checks
+/// - agent 16-Oct-2026 Added the LazyRateOfChange checks
+/// - agent 16-Oct-2026 Added the RateExceptionReporter checks
+/// - agent 16-Oct-2026 Added the FixedPeriodRateOfChange checks
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "ChannelRegistry.hpp"
+#include "CompactHistory.hpp"
+#include "FixedPeriodRateOfChange.hpp"
+#include "FloatLib.hpp"
+#include "KickScheduler.hpp"
+#include "LazyRateOfChange.hpp"
+#include "LeastSquaresSlope.hpp"
+#include "MultiHorizonRateOfChange.hpp"
+#include "RateAlarmBank.hpp"
+#include "RateExceptionReporter.hpp"
+#include "RateOfChange.hpp"
+#include "RateOfChangeBank.hpp"
+#include "SampleRing.hpp"
+#include "SampleScrubber.hpp"
+#include "SignalPipeline.hpp"
+#include "Watchdog.hpp"
+#include "WatchdogMonitor.hpp"
+#include "WatchdogPolicy.hpp"
+#include "WatchdogSupervisor.hpp"
+#include "WatchdogTrace.hpp"
+#include "WatchdogWindow.hpp"
+#include "CaptureFile.hpp"
+#include "CaptureReplay.hpp"
+#include "IWdtSimulator.hpp"
+#include "OfflineRateEngine.hpp"
+#include "WatchdogTraceFile.hpp"
+#include "WorkStealingPool.hpp"
+
+//
+// Records a failed check with its text and line.  A macro so that the check is reported as written.
+//
+#define UNIT_CHECK(bCondition) Check((bCondition), #bCondition, __LINE__)
+
+namespace
+{
+    // Fixed generator seed so every run checks the same inputs
+    const uint32_t INPUT_SEED = 0x7E57u;
+
+    // Failed checks reported per group, the rest are only counted
+    const uint32_t MAX_REPORTED_FAILURES = 20u;
+
+    // Failed checks of the group being run
+    uint32_t g_ulFailures;
+
+    // One group of checks, run by name
+    struct UnitTestGroup
+    {
+        const char * pszName;
+        void      (* pfnRun)(void);
+    };
+
+    // Channel stored in the ChannelRegistry checks
+    struct RegistryEntry
+    {
+        explicit RegistryEntry(uint32_t ulId) : ulId(ulId) {}
+
+        uint32_t ulId;
+    };
+
+    // The window of the IWdtConfig example, 2184533 us to 6553599 us allowing for a 10% clock error
+    typedef CpfBsp::IWdtConfig<15000u, 128u, 1024u, CpfBsp::WINDOW_START_25, CpfBsp::WINDOW_END_75, 10u> ExampleConfig;
+
+    // The same window on an exact clock
+    typedef CpfBsp::IWdtConfig<15000u, 128u, 1024u, CpfBsp::WINDOW_START_25, CpfBsp::WINDOW_END_75, 0u> ExactConfig;
+
+    // A late window on the longest timeout and a clock tolerance that does not divide evenly
+    typedef CpfBsp::IWdtConfig<1000u, 256u, 2048u, CpfBsp::WINDOW_START_50, CpfBsp::WINDOW_END_100, 7u> LateConfig;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: Check
+    ///
+    /// @param  [in]  bPassed       Result of the check.
+    /// @param  [in]  pszCondition  Text of the check.
+    /// @param  [in]  iLine         Line of the check.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void Check(bool bPassed, const char * pszCondition, int iLine)
+    {
+        if (!bPassed)
+        {
+            if (g_ulFailures < MAX_REPORTED_FAILURES)
+            {
+                fprintf(stderr, "UnitTests.cpp:%d: check failed: %s\n", iLine, pszCondition);
+            }
+
+            ++g_ulFailures;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: IsSameFloat
+    ///
+    /// @return whether two floats have the same bits, or are both NaN, whose payload the vector units may not keep
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool IsSameFloat(float fFirst, float fSecond)
+    {
+        return (App::FloatToBits(fFirst) == App::FloatToBits(fSecond)) || (App::IsNan(fFirst) && App::IsNan(fSecond));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: IsNear
+    ///
+    /// @return whether fValue is within a relative tolerance of fExpected
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool IsNear(float fValue, float fExpected, float fRelative)
+    {
+        return fabsf(fValue - fExpected) <= (fabsf(fExpected) * fRelative);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: MakeMixedFloats
+    ///
+    /// @par Full Description
+    /// Builds floats of every class with random signs, exponents and payloads, as Benchmark does, from the raw
+    /// output of a fixed seed Mersenne Twister.
+    ///
+    /// @param  [in]  ulCount   Number of floats.
+    /// @param  [in]  ulSeed    Generator seed.
+    ///
+    /// @return the floats
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<float> MakeMixedFloats(uint32_t ulCount, uint32_t ulSeed)
+    {
+        std::mt19937 Generator(ulSeed);
+        std::vector<float> afValues;
+
+        for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+        {
+            uint32_t ulSign = Generator() & 0x80000000u;
+            uint32_t ulMantissa = Generator() & 0x007FFFFFu;
+            uint32_t ulExponent = 1u + (Generator() % 254u);
+            uint32_t ulPercent = Generator() % 100u;
+            uint32_t ulBits = ulSign | (ulExponent << 23) | ulMantissa;
+
+            if (ulPercent >= 94u)
+            {
+                ulBits = ulSign;                                            // zero
+            }
+            else if (ulPercent >= 88u)
+            {
+                ulBits = ulSign | App::FLOAT_INFINITE_BITS;                 // infinity
+            }
+            else if (ulPercent >= 80u)
+            {
+                ulBits = ulSign | App::FLOAT_INFINITE_BITS | (ulMantissa | 1u);     // NaN
+            }
+            else if (ulPercent >= 70u)
+            {
+                ulBits = ulSign | (ulMantissa | 1u);                        // subnormal
+            }
+
+            afValues.push_back(App::BitsToFloat(ulBits));
+        }
+
+        return afValues;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: MakeTimestamps
+    ///
+    /// @par Full Description
+    /// Builds 1 ms sample timestamps with +/- 32 us of jitter and a repeated timestamp about one sample in 64,
+    /// starting before the 32 bit microsecond counter overflows so that they cross the wrap half way through.
+    ///
+    /// @param  [in]  ulCount   Number of timestamps.
+    /// @param  [in]  ulSeed    Generator seed.
+    ///
+    /// @return the timestamps
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<uint32_t> MakeTimestamps(uint32_t ulCount, uint32_t ulSeed)
+    {
+        std::mt19937 Generator(ulSeed);
+        std::vector<uint32_t> aulTimestampsUs;
+        uint32_t ulTimestampUs = 0xFFFFFFFFu - ((ulCount / 2u) * 1000u);
+
+        for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+        {
+            uint32_t ulRandom = Generator();
+
+            if ((ulRandom & 0x3Fu) != 0u)
+            {
+                ulTimestampUs += 1000u + ((ulRandom >> 8) & 63u) - 32u;
+            }
+
+            aulTimestampsUs.push_back(ulTimestampUs);
+        }
+
+        return aulTimestampsUs;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: CalcDirectSlope
+    ///
+    /// @par Full Description
+    /// Least squares slope of a run of samples, fitted directly in double around the means of the run.
+    ///
+    /// @param  [in]  pfValues          Values of the run.
+    /// @param  [in]  pulTimestampsUs   Timestamps of the run, which may cross the 32 bit overflow.
+    /// @param  [in]  ulCount           Samples in the run.
+    ///
+    /// @return slope in units per microsecond, 0 for a single sample, infinity when every timestamp is equal
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    double CalcDirectSlope(const float * pfValues, const uint32_t * pulTimestampsUs, uint32_t ulCount)
+    {
+        double dMeanT = 0.0;
+        double dMeanV = 0.0;
+
+        for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+        {
+            dMeanT += static_cast<double>(static_cast<int32_t>(pulTimestampsUs[ulIndex] - pulTimestampsUs[0]));
+            dMeanV += static_cast<double>(pfValues[ulIndex]);
+        }
+
+        dMeanT /= static_cast<double>(ulCount);
+        dMeanV /= static_cast<double>(ulCount);
+
+        double dSumSquaresT = 0.0;
+        double dSumProductsTV = 0.0;
+
+        for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+        {
+            double dT = static_cast<double>(static_cast<int32_t>(pulTimestampsUs[ulIndex] - pulTimestampsUs[0])) -
+                        dMeanT;
+
+            dSumSquaresT += dT * dT;
+            dSumProductsTV += dT * (static_cast<double>(pfValues[ulIndex]) - dMeanV);
+        }
+
+        return (ulCount < 2u) ? 0.0 : ((dSumSquaresT > 0.0) ? (dSumProductsTV / dSumSquaresT) : HUGE_VAL);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: CheckLeastSquaresSlope
+    ///
+    /// @par Full Description
+    /// Checks every slope of a LeastSquaresSlope over the samples against a direct fit of its window, through
+    /// many moves of the origin of its running sums.
+    ///
+    /// @param  [in]  rafValues          Values.
+    /// @param  [in]  raulTimestampsUs   Timestamps.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <uint32_t WINDOW_SIZE>
+    void CheckLeastSquaresSlope(const std::vector<float> & rafValues, const std::vector<uint32_t> & raulTimestampsUs)
+    {
+        SignalChain::LeastSquaresSlope<WINDOW_SIZE> Slope;
+
+        for (uint32_t ulIndex = 0; ulIndex < rafValues.size(); ++ulIndex)
+        {
+            uint32_t ulCount = ((ulIndex + 1u) < WINDOW_SIZE) ? (ulIndex + 1u) : WINDOW_SIZE;
+            uint32_t ulFirst = (ulIndex + 1u) - ulCount;
+            float fSlope = Slope.CalcSlopeUs(rafValues[ulIndex], raulTimestampsUs[ulIndex]);
+            double dExpected = CalcDirectSlope(&rafValues[ulFirst], &raulTimestampsUs[ulFirst], ulCount);
+
+            UNIT_CHECK(Slope.GetSampleCount() == ulCount);
+            UNIT_CHECK((dExpected == HUGE_VAL) ? (fSlope == App::FLOAT_INFINITY) :
+                                                 (fabs(fSlope - dExpected) <= (1.0e-5 * (fabs(dExpected) + 1.0e-3))));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: CheckPolicyWindow
+    ///
+    /// @par Full Description
+    /// Checks the window edges of a WatchdogPolicy allowing for the clock tolerance are the tightest whole
+    /// microseconds inside the window on the slowest and the fastest clock, and that IsRefreshPermitted and the
+    /// deadlines follow them.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename Config>
+    void CheckPolicyWindow(void)
+    {
+        typedef CpfBsp::WatchdogPolicy<Config> Policy;
+
+        const uint64_t ullOpen = static_cast<uint64_t>(Policy::TIMEOUT_US) * Config::WINDOW_START;
+        const uint64_t ullClose = static_cast<uint64_t>(Policy::TIMEOUT_US) * Config::WINDOW_END;
+        const uint64_t ullSlow = CpfBsp::WatchdogWindow::CYCLE_PERCENT - Config::CLOCK_TOLERANCE_PERCENT;
+        const uint64_t ullFast = CpfBsp::WatchdogWindow::CYCLE_PERCENT + Config::CLOCK_TOLERANCE_PERCENT;
+
+        // Open on the slowest clock and not a microsecond before, closed on the fastest and not a microsecond after
+        UNIT_CHECK((Policy::SAFE_OPEN_US * ullSlow) >= ullOpen);
+        UNIT_CHECK((Policy::SAFE_OPEN_US == 0u) || (((Policy::SAFE_OPEN_US - 1u) * ullSlow) < ullOpen));
+        UNIT_CHECK((Policy::SAFE_CLOSE_US * ullFast) <= ullClose);
+        UNIT_CHECK(((Policy::SAFE_CLOSE_US + 1ull) * ullFast) > ullClose);
+
+        UNIT_CHECK(Policy::SAFE_OPEN_US >= Policy::OPEN_US);
+        UNIT_CHECK(Policy::SAFE_CLOSE_US <= Policy::CLOSE_US);
+        UNIT_CHECK(Policy::GetWindow().GetOpenUs() == Policy::OPEN_US);
+        UNIT_CHECK(Policy::GetWindow().GetCloseUs() == Policy::CLOSE_US);
+
+        UNIT_CHECK((Policy::SAFE_OPEN_US == 0u) || !Policy::IsRefreshPermitted(Policy::SAFE_OPEN_US - 1u));
+        UNIT_CHECK(Policy::IsRefreshPermitted(Policy::SAFE_OPEN_US));
+        UNIT_CHECK(Policy::IsRefreshPermitted(Policy::SAFE_CLOSE_US));
+        UNIT_CHECK(!Policy::IsRefreshPermitted(Policy::SAFE_CLOSE_US + 1u));
+
+        // Deadlines are modulo 2^32 like the timestamps they are taken from
+        UNIT_CHECK(Policy::GetOpenTimeUs(0xFFFFFFFFu) == (Policy::SAFE_OPEN_US - 1u));
+        UNIT_CHECK(Policy::GetDeadlineUs(0xFFFFFFFFu) == (Policy::SAFE_CLOSE_US - 1u));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestRateOfChangeBank
+    ///
+    /// @par Full Description
+    /// A bank of channels, not a whole number of vectors, against one streaming RateOfChange per channel, with the
+    /// samples crossing the timestamp overflow and one channel reset half way.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestRateOfChangeBank(void)
+    {
+        const uint32_t CHANNEL_COUNT = 37u;
+        const uint32_t SCAN_COUNT = 100u;
+        const uint32_t SCAN_PERIOD = 40u;
+
+        std::vector<float> afValues = MakeMixedFloats(SCAN_COUNT * CHANNEL_COUNT, INPUT_SEED + 2u);
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(SCAN_COUNT * SCAN_PERIOD, INPUT_SEED + 3u);
+
+        SignalChain::StaticRateOfChangeBank<CHANNEL_COUNT> Bank;
+        std::vector<SignalChain::RateOfChange> aChannels(CHANNEL_COUNT);
+        float afScanValues[CHANNEL_COUNT];
+        uint32_t aulScanTimestampsUs[CHANNEL_COUNT];
+        float afScanRates[CHANNEL_COUNT];
+
+        for (uint32_t ulScan = 0; ulScan < SCAN_COUNT; ++ulScan)
+        {
+            if (ulScan == (SCAN_COUNT / 2u))
+            {
+                Bank.ResetChannel(5u);
+                aChannels[5] = SignalChain::RateOfChange();
+            }
+
+            // Each channel sampled at its own time within the scan
+            for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+            {
+                afScanValues[ulChannel] = afValues[(ulScan * CHANNEL_COUNT) + ulChannel];
+                aulScanTimestampsUs[ulChannel] = aulTimestampsUs[(ulScan * SCAN_PERIOD) + ulChannel];
+            }
+
+            Bank.CalcRateOfChangeUs(afScanValues, aulScanTimestampsUs, afScanRates);
+
+            for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+            {
+                float fExpected = aChannels[ulChannel].CalcRateOfChangeUs(afScanValues[ulChannel],
+                                                                          aulScanTimestampsUs[ulChannel]);
+
+                UNIT_CHECK(IsSameFloat(afScanRates[ulChannel], fExpected));
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestRateOfChangeBatch
+    ///
+    /// @par Full Description
+    /// Batches of uneven sizes through the batch CalcRateOfChangeUs against one sample at a time.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestRateOfChangeBatch(void)
+    {
+        const uint32_t SAMPLE_COUNT = 4099u;
+        static const uint32_t BATCH_SIZES[] = { 1u, 2u, 3u, 5u, 8u, 13u, 21u, 34u, 55u, 89u };
+
+        std::vector<float> afValues = MakeMixedFloats(SAMPLE_COUNT, INPUT_SEED + 2u);
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(SAMPLE_COUNT, INPUT_SEED + 3u);
+        std::vector<float> afRates(SAMPLE_COUNT);
+
+        SignalChain::RateOfChange Streamed;
+        SignalChain::RateOfChange Batched;
+
+        for (uint32_t ulStart = 0, ulBatch = 0; ulStart < SAMPLE_COUNT; ++ulBatch)
+        {
+            uint32_t ulCount = BATCH_SIZES[ulBatch % (sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]))];
+
+            ulCount = (ulCount < (SAMPLE_COUNT - ulStart)) ? ulCount : (SAMPLE_COUNT - ulStart);
+
+            Batched.CalcRateOfChangeUs(afValues.data() + ulStart, aulTimestampsUs.data() + ulStart,
+                                       afRates.data() + ulStart, ulCount);
+            ulStart += ulCount;
+        }
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            float fExpected = Streamed.CalcRateOfChangeUs(afValues[ulIndex], aulTimestampsUs[ulIndex]);
+
+            UNIT_CHECK(IsSameFloat(afRates[ulIndex], fExpected));
+        }
+
+        // An empty batch leaves the state alone
+        Batched.CalcRateOfChangeUs(afValues.data(), aulTimestampsUs.data(), afRates.data(), 0u);
+
+        UNIT_CHECK(IsSameFloat(Batched.CalcRateOfChangeUs(1.0f, aulTimestampsUs[SAMPLE_COUNT - 1u] + 1000u),
+                               Streamed.CalcRateOfChangeUs(1.0f, aulTimestampsUs[SAMPLE_COUNT - 1u] + 1000u)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestRateOfChangeUnits
+    ///
+    /// @par Full Description
+    /// The first call, a timestamp overflow and equal timestamps in each output unit, and the infinity and NaN
+    /// being the IEEE values.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestRateOfChangeUnits(void)
+    {
+        UNIT_CHECK(App::FloatToBits(App::FLOAT_INFINITY) == App::FLOAT_INFINITE_BITS);
+        UNIT_CHECK(App::IsInf(App::FLOAT_INFINITY) && (App::FLOAT_INFINITY > 0.0f));
+        UNIT_CHECK(App::IsNan(App::FLOAT_NAN));
+
+        // The first call gives 0, the modulo difference spans the overflow and equal timestamps give +infinity
+        SignalChain::RateOfChange Rate;
+
+        UNIT_CHECK(Rate.CalcRateOfChangeUs(5.0f, 0xFFFFFF00u) == 0.0f);
+        UNIT_CHECK(Rate.CalcRateOfChangeUs(517.0f, 0x00000100u) == 1.0f);
+        UNIT_CHECK(Rate.CalcRateOfChangeUs(-100.0f, 0x00000100u) == App::FLOAT_INFINITY);
+        UNIT_CHECK(IsNear(Rate.CalcRateOfChangeSec(-99.0f, 0x000004E8u), 1000.0f, 1.0e-6f));
+
+        // Milliseconds and seconds pass the infinity straight through rather than scaling it
+        SignalChain::RateOfChange MsRate;
+        SignalChain::RateOfChange SecRate;
+
+        UNIT_CHECK(MsRate.CalcRateOfChangeMs(0.0f, 0xFFFFFC18u) == 0.0f);
+        UNIT_CHECK(IsNear(MsRate.CalcRateOfChangeMs(3.0f, 0x000007D0u), 1.0f, 1.0e-6f));
+        UNIT_CHECK(MsRate.CalcRateOfChangeMs(4.0f, 0x000007D0u) == App::FLOAT_INFINITY);
+        UNIT_CHECK(SecRate.CalcRateOfChangeSec(0.0f, 1000u) == 0.0f);
+        UNIT_CHECK(SecRate.CalcRateOfChangeSec(-1.0f, 1000u) == App::FLOAT_INFINITY);
+        UNIT_CHECK(IsNear(SecRate.CalcRateOfChangeSec(1.0f, 501000u), 4.0f, 1.0e-6f));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestFloatLib
+    ///
+    /// @par Full Description
+    /// The array classification, scan and search against the scalar classification, over every length and
+    /// alignment around the vector widths.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestFloatLib(void)
+    {
+        static const uint32_t LENGTHS[] = { 0u, 1u, 3u, 7u, 8u, 9u, 15u, 16u, 17u, 31u, 32u, 33u, 100u, 4099u };
+        static const uint32_t OFFSETS[] = { 0u, 1u, 3u };
+        static const uint32_t MASKS[] =
+        {
+            0u,
+            App::FLP_MASK_INFINITE,
+            App::FLP_MASK_NAN,
+            App::FLP_MASK_NORMAL,
+            App::FLP_MASK_SUBNORMAL,
+            App::FLP_MASK_ZERO,
+            App::FLP_MASK_INFINITE | App::FLP_MASK_NAN,
+            App::FLP_MASK_NAN | App::FLP_MASK_SUBNORMAL | App::FLP_MASK_ZERO
+        };
+
+        std::vector<float> afInputs = MakeMixedFloats(4104u, INPUT_SEED);
+        std::vector<uint8_t> aubTypes(afInputs.size());
+
+        for (uint32_t ulLength : LENGTHS)
+        {
+            for (uint32_t ulOffset : OFFSETS)
+            {
+                const float * pfInput = afInputs.data() + ulOffset;
+
+                App::FpClassify(pfInput, aubTypes.data(), ulLength);
+
+                App::FloatScanResult Scan;
+                App::FpScan(pfInput, ulLength, Scan);
+
+                uint32_t aulCounts[App::FLP_TYPE_COUNT] = { 0u };
+                uint32_t aulFirst[App::FLP_TYPE_COUNT];
+
+                for (uint32_t ulType = 0; ulType < App::FLP_TYPE_COUNT; ++ulType)
+                {
+                    aulFirst[ulType] = ulLength;
+                }
+
+                for (uint32_t ulIndex = 0; ulIndex < ulLength; ++ulIndex)
+                {
+                    uint32_t ulType = App::FpClassify(pfInput[ulIndex]);
+
+                    UNIT_CHECK(aubTypes[ulIndex] == ulType);
+
+                    aulFirst[ulType] = (aulCounts[ulType] == 0u) ? ulIndex : aulFirst[ulType];
+                    ++aulCounts[ulType];
+                }
+
+                for (uint32_t ulType = 0; ulType < App::FLP_TYPE_COUNT; ++ulType)
+                {
+                    UNIT_CHECK(Scan.aulCount[ulType] == aulCounts[ulType]);
+                    UNIT_CHECK(Scan.aulFirstIndex[ulType] == aulFirst[ulType]);
+                }
+
+                for (uint32_t ulMask : MASKS)
+                {
+                    uint32_t ulExpected = 0;
+
+                    while ((ulExpected < ulLength) && (((1u << App::FpClassify(pfInput[ulExpected])) & ulMask) == 0u))
+                    {
+                        ++ulExpected;
+                    }
+
+                    UNIT_CHECK(App::FpFindFirst(pfInput, ulLength, ulMask) == ulExpected);
+                }
+            }
+        }
+
+        // A single NaN among normals, in every position of the vectors and in the tail
+        std::vector<float> afNormals(67u, 1.5f);
+
+        for (uint32_t ulIndex = 0; ulIndex < afNormals.size(); ++ulIndex)
+        {
+            afNormals[ulIndex] = App::FLOAT_NAN;
+
+            UNIT_CHECK(App::FpFindFirst(afNormals.data(), 67u, App::FLP_MASK_NAN) == ulIndex);
+            UNIT_CHECK(App::FpFindFirst(afNormals.data(), ulIndex, App::FLP_MASK_NAN) == ulIndex);
+
+            afNormals[ulIndex] = 1.5f;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestFloatClassify
+    ///
+    /// @par Full Description
+    /// The branchless scalar classification at the class boundaries and against the C library over a spread of bit
+    /// patterns, and at compile time where the compiler allows it.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestFloatClassify(void)
+    {
+#if defined(__cpp_lib_bit_cast) || defined(FLOATLIB_BUILTIN_BIT_CAST)
+        static_assert(App::FpClassify(App::BitsToFloat(0x00000001u)) == App::FLP_SUBNORMAL, "constexpr FpClassify");
+        static_assert(App::IsNan(App::FLOAT_NAN) && !App::IsFinite(App::FLOAT_INFINITY), "constexpr IsNan");
+#endif
+
+        UNIT_CHECK(App::FpClassify(App::BitsToFloat(0x00800000u)) == App::FLP_NORMAL);
+        UNIT_CHECK(App::FpClassify(App::BitsToFloat(0x807FFFFFu)) == App::FLP_SUBNORMAL);
+        UNIT_CHECK(App::FpClassify(App::BitsToFloat(0x80000000u)) == App::FLP_ZERO);
+        UNIT_CHECK(App::FpClassify(App::BitsToFloat(0x7F7FFFFFu)) == App::FLP_NORMAL);
+        UNIT_CHECK(App::FpClassify(App::BitsToFloat(0xFF800000u)) == App::FLP_INFINITE);
+        UNIT_CHECK(App::FpClassify(App::BitsToFloat(0x7F800001u)) == App::FLP_NAN);
+
+        // Every class of both signs is visited, the stride being odd and close to 2^16
+        for (uint64_t ullBits = 0; ullBits <= 0xFFFFFFFFull; ullBits += 65521u)
+        {
+            float fValue = App::BitsToFloat(static_cast<uint32_t>(ullBits));
+            int iClass = std::fpclassify(fValue);
+
+            UNIT_CHECK(App::IsNan(fValue) == (iClass == FP_NAN));
+            UNIT_CHECK(App::IsInf(fValue) == (iClass == FP_INFINITE));
+            UNIT_CHECK(App::IsFinite(fValue) == ((iClass != FP_NAN) && (iClass != FP_INFINITE)));
+            UNIT_CHECK(App::IsSubnormal(fValue) == (iClass == FP_SUBNORMAL));
+            UNIT_CHECK((App::FpClassify(fValue) == App::FLP_ZERO) == (iClass == FP_ZERO));
+            UNIT_CHECK((App::FpClassify(fValue) == App::FLP_NORMAL) == (iClass == FP_NORMAL));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestLeastSquaresSlope
+    ///
+    /// @par Full Description
+    /// A noisy ramp far from zero, sampled with jitter and repeats across the timestamp overflow, against a direct
+    /// fit of each window, for the smallest window and a longer one.  Equal timestamps, and Reset.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestLeastSquaresSlope(void)
+    {
+        const uint32_t SAMPLE_COUNT = 5000u;
+
+        std::mt19937 Generator(INPUT_SEED + 40u);
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(SAMPLE_COUNT, INPUT_SEED + 41u);
+        std::vector<float> afValues;
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            float fNoise = static_cast<float>(static_cast<int32_t>(Generator() % 2001u) - 1000) / 1000.0f;
+
+            afValues.push_back(100000.0f + (2.0f * static_cast<float>(ulIndex)) + fNoise);
+        }
+
+        CheckLeastSquaresSlope<2>(afValues, aulTimestampsUs);
+        CheckLeastSquaresSlope<8>(afValues, aulTimestampsUs);
+        CheckLeastSquaresSlope<61>(afValues, aulTimestampsUs);
+
+        // Equal timestamps across the whole window have no slope, until a later timestamp enters it
+        SignalChain::LeastSquaresSlope<3> Slope;
+
+        UNIT_CHECK(Slope.CalcSlopeUs(1.0f, 5000u) == 0.0f);
+        UNIT_CHECK(Slope.CalcSlopeUs(2.0f, 5000u) == App::FLOAT_INFINITY);
+        UNIT_CHECK(Slope.CalcSlopeUs(3.0f, 5000u) == App::FLOAT_INFINITY);
+        UNIT_CHECK(IsNear(Slope.CalcSlopeUs(5.0f, 5003u), 5.0f / 6.0f, 1.0e-6f));
+
+        Slope.Reset();
+
+        UNIT_CHECK(Slope.GetSampleCount() == 0u);
+        UNIT_CHECK(Slope.CalcSlopeUs(7.0f, 9000u) == 0.0f);
+        UNIT_CHECK(IsNear(Slope.CalcSlopeUs(9.0f, 9004u), 0.5f, 1.0e-6f));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestSampleRing
+    ///
+    /// @par Full Description
+    /// Overruns on a full ring, Pop and Drain across the end of the storage against a serial RateOfChange, and a
+    /// producer thread against a consumer thread losing or reordering nothing but the overruns it counts.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestSampleRing(void)
+    {
+        const uint32_t CAPACITY = 16u;
+
+        SignalChain::SampleRing<CAPACITY> Ring;
+        SignalChain::RateOfChange Drained;
+        SignalChain::RateOfChange Serial;
+        float afValues[2u * CAPACITY];
+        uint32_t aulTimestampsUs[2u * CAPACITY];
+        float afRates[2u * CAPACITY];
+
+        UNIT_CHECK(Ring.Pop(afValues, aulTimestampsUs, CAPACITY) == 0u);
+        UNIT_CHECK(Ring.Drain(Drained, afRates, CAPACITY) == 0u);
+
+        // A full ring drops and counts the samples pushed, and keeps the ones it holds
+        for (uint32_t ulIndex = 0; ulIndex < (CAPACITY + 4u); ++ulIndex)
+        {
+            UNIT_CHECK(Ring.Push(static_cast<float>(ulIndex), 0xFFFFFFFFu - 6000u + (ulIndex * 1000u)) ==
+                       (ulIndex < CAPACITY));
+        }
+
+        UNIT_CHECK(Ring.GetOverrunCount() == 4u);
+        UNIT_CHECK(Ring.Pop(afValues, aulTimestampsUs, 5u) == 5u);
+
+        for (uint32_t ulIndex = 0; ulIndex < 5u; ++ulIndex)
+        {
+            UNIT_CHECK((afValues[ulIndex] == static_cast<float>(ulIndex)) &&
+                       (aulTimestampsUs[ulIndex] == (0xFFFFFFFFu - 6000u + (ulIndex * 1000u))));
+
+            Serial.CalcRateOfChangeUs(afValues[ulIndex], aulTimestampsUs[ulIndex]);
+            Drained.CalcRateOfChangeUs(afValues[ulIndex], aulTimestampsUs[ulIndex]);
+        }
+
+        // Samples pushed after the Pop wrap to the start of the storage, and drain in two runs
+        for (uint32_t ulIndex = CAPACITY; ulIndex < (CAPACITY + 5u); ++ulIndex)
+        {
+            UNIT_CHECK(Ring.Push(static_cast<float>(ulIndex * ulIndex), 0xFFFFFFFFu - 6000u + (ulIndex * 1000u)));
+        }
+
+        UNIT_CHECK(!Ring.Push(0.0f, 0u));
+        UNIT_CHECK(Ring.GetOverrunCount() == 5u);
+        UNIT_CHECK(Ring.Drain(Drained, afRates, 3u) == 3u);
+        UNIT_CHECK(Ring.Drain(Drained, afRates + 3u, 2u * CAPACITY) == (CAPACITY - 3u));
+        UNIT_CHECK(Ring.Drain(Drained, afRates, 2u * CAPACITY) == 0u);
+
+        for (uint32_t ulIndex = 5u; ulIndex < (CAPACITY + 5u); ++ulIndex)
+        {
+            uint32_t ulSample = (ulIndex < CAPACITY) ? ulIndex : (ulIndex * ulIndex);
+            float fExpected = Serial.CalcRateOfChangeUs(static_cast<float>(ulSample),
+                                                        0xFFFFFFFFu - 6000u + (ulIndex * 1000u));
+
+            UNIT_CHECK(IsSameFloat(afRates[ulIndex - 5u], fExpected));
+        }
+
+        //
+        // A producer thread pushing as fast as it can against a consumer popping in batches: every sample either
+        // arrives, in order and with its own timestamp, or is counted as an overrun.
+        //
+        const uint32_t SAMPLE_COUNT = 200000u;
+
+        static SignalChain::SampleRing<256> Shared;
+        std::atomic<bool> bProduced(false);
+        std::vector<float> afReceived;
+        uint32_t ulMismatches = 0;
+
+        std::thread Producer([&]()
+        {
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                Shared.Push(static_cast<float>(ulIndex), ulIndex * 3u);
+            }
+
+            bProduced.store(true, std::memory_order_release);
+        });
+
+        // Once the producer has finished, one more Pop until empty collects the rest
+        for (bool bLast = false, bEmpty = false; !(bLast && bEmpty); )
+        {
+            bLast = bProduced.load(std::memory_order_acquire);
+
+            uint32_t ulCount = Shared.Pop(afValues, aulTimestampsUs, 2u * CAPACITY);
+
+            bEmpty = (ulCount == 0u);
+
+            for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+            {
+                afReceived.push_back(afValues[ulIndex]);
+                ulMismatches += (aulTimestampsUs[ulIndex] == (static_cast<uint32_t>(afValues[ulIndex]) * 3u)) ? 0u : 1u;
+            }
+        }
+
+        Producer.join();
+
+        UNIT_CHECK(ulMismatches == 0u);
+        UNIT_CHECK(std::is_sorted(afReceived.begin(), afReceived.end()));
+        UNIT_CHECK(std::adjacent_find(afReceived.begin(), afReceived.end()) == afReceived.end());
+        UNIT_CHECK((afReceived.size() + Shared.GetOverrunCount()) == SAMPLE_COUNT);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestWatchdogSupervisor
+    ///
+    /// @par Full Description
+    /// Two tasks checking in under a windowed watchdog on the simulator: refreshed in the window while both are
+    /// alive, and once one stops, found late after its deadline, the refresh withheld and traced once, and the MCU
+    /// reset by the simulated IWDT.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestWatchdogSupervisor(void)
+    {
+        typedef CpfBsp::WatchdogSupervisor<40> Supervisor;
+
+        const CpfBsp::WatchdogWindow Window = { 2000000u, CpfBsp::WINDOW_START_25, CpfBsp::WINDOW_END_75 };
+        const uint32_t FAST_TASK = 3u;
+        const uint32_t SLOW_TASK = 33u;
+        const uint32_t DEADLINE_US = 50000u;
+
+        static CpfBsp::WatchdogTraceRegion Region;
+        CpfBsp::WatchdogTraceEvent aEvents[CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT];
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+        CpfBsp::KickScheduler Scheduler(Window, 1000u);
+        Supervisor Tasks(Scheduler);
+        uint32_t ulNowUs = 0xFFFFFFFFu - 2500000u;
+
+        Region.ulMagic = 0u;
+        CpfBsp::WatchdogTrace::Attach(&Region);
+        rSimulator.PowerOn(Window);
+        Scheduler.Start(ulNowUs);
+
+        UNIT_CHECK(!Tasks.RegisterTask(40u, DEADLINE_US, ulNowUs));
+        UNIT_CHECK(Tasks.RegisterTask(FAST_TASK, DEADLINE_US, ulNowUs, true));
+        UNIT_CHECK(Tasks.RegisterTask(SLOW_TASK, DEADLINE_US, ulNowUs));
+        UNIT_CHECK(Tasks.GetLateTask() == Supervisor::NO_TASK);
+
+        // A check-in is collected, and traced, by the next Service, once however often the task checked in
+        Tasks.CheckIn(FAST_TASK);
+        Tasks.CheckIn(FAST_TASK);
+        Tasks.CheckIn(SLOW_TASK);
+
+        UNIT_CHECK(Tasks.Service(ulNowUs));
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT) == 1u);
+        UNIT_CHECK((aEvents[0].eType == CpfBsp::TRACE_CHECK_IN) && (aEvents[0].ulId == FAST_TASK));
+
+        UNIT_CHECK(Tasks.RegisterTask(FAST_TASK, DEADLINE_US, ulNowUs));
+
+        Region.ulMagic = 0u;
+        CpfBsp::WatchdogTrace::Attach(&Region);
+
+        //
+        // Both tasks alive for 10 s: the scheduler refreshes once per cycle inside the window.  A refresh at every
+        // Service would come before the window opens and reset the MCU.
+        //
+        for (uint32_t ulTick = 1; ulTick <= 10000u; ++ulTick)
+        {
+            rSimulator.AdvanceUs(1000u);
+            ulNowUs += 1000u;
+
+            Tasks.CheckIn(FAST_TASK);
+
+            if ((ulTick % 20u) == 0u)
+            {
+                Tasks.CheckIn(SLOW_TASK);
+            }
+
+            UNIT_CHECK(Tasks.Service(ulNowUs));
+            Scheduler.Tick(ulNowUs);
+        }
+
+        UNIT_CHECK(Tasks.GetLateTask() == Supervisor::NO_TASK);
+        UNIT_CHECK(rSimulator.GetRefreshCount() == 10u);
+        UNIT_CHECK(rSimulator.GetResetCount() == 0u);
+
+        // The slow task stops, and is late at the first Service more than its deadline after its last check-in
+        uint32_t ulLateTick = 0;
+
+        for (uint32_t ulTick = 1; ulTick <= 2500u; ++ulTick)
+        {
+            rSimulator.AdvanceUs(1000u);
+            ulNowUs += 1000u;
+
+            Tasks.CheckIn(FAST_TASK);
+
+            bool bRequested = Tasks.Service(ulNowUs);
+
+            Scheduler.Tick(ulNowUs);
+
+            ulLateTick = ((ulLateTick == 0u) && !bRequested) ? ulTick : ulLateTick;
+        }
+
+        UNIT_CHECK(ulLateTick == ((DEADLINE_US / 1000u) + 1u));
+        UNIT_CHECK(Tasks.GetLateTask() == SLOW_TASK);
+        UNIT_CHECK(rSimulator.GetRefreshCount() == 10u);
+        UNIT_CHECK(rSimulator.GetResetCount() == 1u);
+        UNIT_CHECK((rSimulator.ReadStatus() & Host::IWdtSimulator::STATUS_UNDERFLOW) != 0u);
+
+        // The refresh was withheld at every Service from then on, but traced only the first time
+        uint32_t ulEventCount = CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT);
+        uint32_t ulWithheld = 0;
+
+        for (uint32_t ulEvent = 0; ulEvent < ulEventCount; ++ulEvent)
+        {
+            ulWithheld += (aEvents[ulEvent].eType == CpfBsp::TRACE_WITHHELD) ? 1u : 0u;
+
+            UNIT_CHECK(aEvents[ulEvent].eType != CpfBsp::TRACE_CHECK_IN);
+            UNIT_CHECK((aEvents[ulEvent].eType != CpfBsp::TRACE_WITHHELD) || (aEvents[ulEvent].ulId == SLOW_TASK));
+        }
+
+        UNIT_CHECK(ulWithheld == 1u);
+        UNIT_CHECK(ulEventCount == 11u);
+
+        // Unregistered, the slow task no longer holds the refresh back
+        Tasks.UnregisterTask(SLOW_TASK);
+
+        UNIT_CHECK(Tasks.Service(ulNowUs));
+        UNIT_CHECK(Tasks.GetLateTask() == Supervisor::NO_TASK);
+
+        CpfBsp::WatchdogTrace::Attach(0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestKickScheduler
+    ///
+    /// @par Full Description
+    /// The refresh window arithmetic, and KickScheduler driving the simulated IWDT across the timestamp overflow.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestKickScheduler(void)
+    {
+        const CpfBsp::WatchdogWindow Window = { 2000000u, CpfBsp::WINDOW_START_25, CpfBsp::WINDOW_END_75 };
+
+        UNIT_CHECK(Window.GetOpenUs() == 500000u);
+        UNIT_CHECK(Window.GetCloseUs() == 1500000u);
+        UNIT_CHECK(Window.GetMidpointUs() == 1000000u);
+        UNIT_CHECK(!Window.IsRefreshPermitted(499999u) && Window.IsRefreshPermitted(500000u));
+        UNIT_CHECK(Window.IsRefreshPermitted(1500000u) && !Window.IsRefreshPermitted(1500001u));
+
+        const CpfBsp::WatchdogWindow Longest = { 0xFFFFFFFFu, CpfBsp::WINDOW_START_75, CpfBsp::WINDOW_END_100 };
+
+        UNIT_CHECK(Longest.GetOpenUs() == 3221225471u);
+        UNIT_CHECK(Longest.GetCloseUs() == 0xFFFFFFFFu);
+
+        //
+        // With kicks requested every tick it refreshes once per cycle at the window midpoint, across the timestamp
+        // overflow, and the watchdog never expires.  Once the requests stop it counts the missed cycle and the
+        // simulated watchdog resets the MCU.
+        //
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+        CpfBsp::KickScheduler Scheduler(Window, 1000u);
+        uint32_t ulNowUs = 0xFFFFFFFFu - 2500000u;
+
+        rSimulator.PowerOn(Window);
+        Scheduler.Start(ulNowUs);
+
+        for (uint32_t ulTick = 0; ulTick < 10000u; ++ulTick)
+        {
+            rSimulator.AdvanceUs(1000u);
+            ulNowUs += 1000u;
+
+            Scheduler.RequestKick();
+            Scheduler.Tick(ulNowUs);
+        }
+
+        UNIT_CHECK(Scheduler.GetRefreshCount() == 10u);
+        UNIT_CHECK(Scheduler.GetMissedCount() == 0u);
+        UNIT_CHECK(rSimulator.GetRefreshCount() == 10u);
+        UNIT_CHECK(rSimulator.GetResetCount() == 0u);
+
+        // A cancelled request is not acted on
+        Scheduler.RequestKick();
+        Scheduler.CancelKick();
+
+        for (uint32_t ulTick = 0; ulTick < 2000u; ++ulTick)
+        {
+            rSimulator.AdvanceUs(1000u);
+            ulNowUs += 1000u;
+
+            Scheduler.Tick(ulNowUs);
+        }
+
+        UNIT_CHECK(Scheduler.GetRefreshCount() == 10u);
+        UNIT_CHECK(Scheduler.GetMissedCount() == 1u);
+        UNIT_CHECK(rSimulator.GetResetCount() == 1u);
+        UNIT_CHECK((rSimulator.ReadStatus() & Host::IWdtSimulator::STATUS_UNDERFLOW) != 0u);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestWatchdogMonitor
+    ///
+    /// @par Full Description
+    /// LatencyHistogram bucket indexing, percentiles, and snapshots and resets against their baselines, then the
+    /// WatchdogMonitor histograms and early and late counts of refreshes either side of the window.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestWatchdogMonitor(void)
+    {
+        typedef CpfBsp::LatencyHistogram<5u, 2u> Histogram;
+        typedef Histogram::Snapshot Snapshot;
+
+        // Values below 32 have a bucket each, above that a bucket is within 1/16 of its values, without gaps
+        UNIT_CHECK(Snapshot::GetBucketIndex(0xFFFFFFFFu) == (Snapshot::BUCKET_COUNT - 1u));
+        UNIT_CHECK(Snapshot::GetBucketHighest(Snapshot::BUCKET_COUNT - 1u) == 0xFFFFFFFFu);
+
+        for (uint32_t ulIndex = 0; ulIndex < Snapshot::BUCKET_COUNT; ++ulIndex)
+        {
+            uint32_t ulLowest = Snapshot::GetBucketLowest(ulIndex);
+            uint32_t ulHighest = Snapshot::GetBucketHighest(ulIndex);
+
+            UNIT_CHECK((ulIndex >= 32u) || ((ulLowest == ulIndex) && (ulHighest == ulIndex)));
+            UNIT_CHECK((ulHighest - ulLowest) <= (ulLowest / 16u));
+            UNIT_CHECK(Snapshot::GetBucketIndex(ulLowest) == ulIndex);
+            UNIT_CHECK(Snapshot::GetBucketIndex(ulHighest) == ulIndex);
+            UNIT_CHECK((ulIndex == 0u) || (Snapshot::GetBucketHighest(ulIndex - 1u) == (ulLowest - 1u)));
+        }
+
+        // Percentiles of 1 to 1000 are the top of the bucket holding the value of that rank
+        static Histogram Latencies;
+        Snapshot Counts;
+
+        for (uint32_t ulValue = 1; ulValue <= 1000u; ++ulValue)
+        {
+            Latencies.Record(ulValue, ulValue % 2u);
+        }
+
+        Latencies.TakeSnapshot(Counts);
+
+        UNIT_CHECK(Counts.GetTotalCount() == 1000u);
+        UNIT_CHECK(Counts.GetMinValue() == 1u);
+        UNIT_CHECK(Counts.GetValueAtPercentile(0.0f) == 1u);
+        UNIT_CHECK(Counts.GetValueAtPercentile(50.0f) == Snapshot::GetBucketHighest(Snapshot::GetBucketIndex(500u)));
+        UNIT_CHECK(Counts.GetValueAtPercentile(99.9f) == Snapshot::GetBucketHighest(Snapshot::GetBucketIndex(999u)));
+        UNIT_CHECK(Counts.GetMaxValue() == Snapshot::GetBucketHighest(Snapshot::GetBucketIndex(1000u)));
+        UNIT_CHECK(Counts.GetCount(Snapshot::GetBucketIndex(7u)) == 1u);
+
+        // A snapshot and reset, then only what was recorded since counts
+        Latencies.TakeSnapshotAndReset(Counts);
+
+        UNIT_CHECK(Counts.GetTotalCount() == 1000u);
+
+        Latencies.Record(7u, 0u);
+        Latencies.Record(7u, 1u);
+        Latencies.TakeSnapshot(Counts);
+
+        UNIT_CHECK((Counts.GetTotalCount() == 2u) && (Counts.GetCount(Snapshot::GetBucketIndex(7u)) == 2u));
+        UNIT_CHECK((Counts.GetMinValue() == 7u) && (Counts.GetMaxValue() == 7u));
+
+        Latencies.Reset();
+        Latencies.TakeSnapshot(Counts);
+
+        UNIT_CHECK((Counts.GetTotalCount() == 0u) && (Counts.GetMaxValue() == 0u) && (Counts.GetMinValue() == 0u));
+
+        //
+        // Refreshes of a 2 s, 25% to 75% window across the timestamp overflow: one at the midpoint with 0.5 s of
+        // margin either side, one early and one late.
+        //
+        const CpfBsp::WatchdogWindow Window = { 2000000u, CpfBsp::WINDOW_START_25, CpfBsp::WINDOW_END_75 };
+
+        static CpfBsp::WatchdogMonitor Monitor(Window);
+        CpfBsp::WatchdogMonitor::Histogram::Snapshot Margins;
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+        uint32_t ulNowUs = 0xFFFFFFFFu - 500000u;
+
+        rSimulator.PowerOn(Window);
+        Monitor.Start(ulNowUs);
+
+        rSimulator.AdvanceUs(1000000u);
+        ulNowUs += 1000000u;
+        Monitor.KickWatchdog(ulNowUs);
+
+        UNIT_CHECK((rSimulator.GetRefreshCount() == 1u) && (rSimulator.GetResetCount() == 0u));
+
+        Monitor.Record(ulNowUs + 100000u);
+        Monitor.Record(ulNowUs + 100000u + 1600000u);
+
+        UNIT_CHECK((Monitor.GetEarlyCount() == 1u) && (Monitor.GetLateCount() == 1u));
+
+        Monitor.GetIntervalHistogram().TakeSnapshot(Margins);
+
+        UNIT_CHECK(Margins.GetTotalCount() == 3u);
+        UNIT_CHECK(Margins.GetMinValue() == Snapshot::GetBucketLowest(Snapshot::GetBucketIndex(100000u)));
+
+        Monitor.GetOpenMarginHistogram().TakeSnapshot(Margins);
+
+        UNIT_CHECK(Margins.GetTotalCount() == 2u);
+        UNIT_CHECK(Margins.GetMinValue() == Snapshot::GetBucketLowest(Snapshot::GetBucketIndex(500000u)));
+
+        Monitor.GetCloseMarginHistogram().TakeSnapshot(Margins);
+
+        UNIT_CHECK(Margins.GetTotalCount() == 2u);
+        UNIT_CHECK(Margins.GetMaxValue() == Snapshot::GetBucketHighest(Snapshot::GetBucketIndex(1400000u)));
+
+        // Reset starts the counts afresh from the counts at the time, and the timing carries on
+        Monitor.Reset();
+
+        UNIT_CHECK((Monitor.GetEarlyCount() == 0u) && (Monitor.GetLateCount() == 0u));
+
+        Monitor.Record(ulNowUs + 100000u + 1600000u + 10000u);
+        Monitor.GetIntervalHistogram().TakeSnapshot(Margins);
+
+        UNIT_CHECK((Monitor.GetEarlyCount() == 1u) && (Monitor.GetLateCount() == 0u));
+        UNIT_CHECK(Margins.GetTotalCount() == 1u);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestIWdtSimulator
+    ///
+    /// @par Full Description
+    /// The simulated IWDT the watchdog checks run against: refreshes at the window edges, a refresh outside the
+    /// window, an underflow, a broken refresh sequence, the down counter and the status flags.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestIWdtSimulator(void)
+    {
+        const CpfBsp::WatchdogWindow Window = { 2000000u, CpfBsp::WINDOW_START_25, CpfBsp::WINDOW_END_75 };
+        const uint16_t COUNTER_MASK = Host::IWdtSimulator::STATUS_COUNTER_MASK;
+
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+
+        rSimulator.PowerOn(Window);
+
+        UNIT_CHECK(CpfBsp::Watchdog::GetResetStatus() == 0u);
+        UNIT_CHECK((rSimulator.ReadStatus() & COUNTER_MASK) == COUNTER_MASK);
+
+        // Refreshes at the very edges of the window are accepted and restart the cycle
+        rSimulator.AdvanceUs(500000u);
+        CpfBsp::Watchdog::KickWatchdog();
+        rSimulator.AdvanceUs(1500000u);
+
+        UNIT_CHECK((rSimulator.ReadStatus() & COUNTER_MASK) == (COUNTER_MASK / 4u));
+
+        CpfBsp::Watchdog::KickWatchdog();
+
+        UNIT_CHECK((rSimulator.GetRefreshCount() == 2u) && (rSimulator.GetResetCount() == 0u));
+        UNIT_CHECK(rSimulator.GetTimeUs() == 2000000u);
+
+        // A microsecond before the window opens is a refresh error, which resets the MCU and starts a new cycle
+        rSimulator.AdvanceUs(499999u);
+        CpfBsp::Watchdog::KickWatchdog();
+
+        UNIT_CHECK((rSimulator.GetRefreshCount() == 2u) && (rSimulator.GetResetCount() == 1u));
+        UNIT_CHECK(CpfBsp::Watchdog::GetResetStatus() == CpfBsp::Watchdog::STATUS_REFRESH_ERROR);
+
+        rSimulator.WriteStatus(0u);
+
+        UNIT_CHECK(CpfBsp::Watchdog::GetResetStatus() == 0u);
+
+        // No refresh for three timeouts underflows three times
+        rSimulator.AdvanceUs(6000000u);
+
+        UNIT_CHECK(rSimulator.GetResetCount() == 4u);
+        UNIT_CHECK(CpfBsp::Watchdog::GetResetStatus() == CpfBsp::Watchdog::STATUS_UNDERFLOW);
+
+        // A second byte without the first is a sequence error and refreshes nothing
+        rSimulator.AdvanceUs(1000000u);
+        rSimulator.WriteRefresh(0xFFu);
+
+        UNIT_CHECK((rSimulator.GetSequenceErrorCount() == 1u) && (rSimulator.GetRefreshCount() == 2u));
+
+        rSimulator.PowerOn(Window);
+
+        UNIT_CHECK((rSimulator.GetResetCount() == 0u) && (CpfBsp::Watchdog::GetResetStatus() == 0u));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestCaptureFile
+    ///
+    /// @par Full Description
+    /// File sizes and column alignment, a round trip of both layouts through the disk, rejection of damaged files
+    /// and a replay against a serial RateOfChange.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestCaptureFile(void)
+    {
+        const char * const RECORDS_PATH = "UnitTests.records.cap";
+        const char * const COLUMNS_PATH = "UnitTests.columns.cap";
+        const char * const RATES_PATH = "UnitTests.rates.cap";
+        const uint32_t SAMPLE_COUNT = 1001u;
+        const uint32_t CHANNEL_COUNT = 3u;
+
+        UNIT_CHECK(Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_RECORDS, 1u, 10u) == (64u + 80u));
+        UNIT_CHECK(Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_RECORDS, 2u, 10u) == 0u);
+        UNIT_CHECK(Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_COLUMNS, 0u, 10u) == 0u);
+        UNIT_CHECK(Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_COLUMNS, 2u, 0u) == 0u);
+        UNIT_CHECK(Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_COLUMNS, 2u, 17u) == (64u + (3u * 128u)));
+        UNIT_CHECK(Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_COLUMNS, 1u, 1ull << 41) == 0u);
+
+        std::vector<float> afValues = MakeMixedFloats(SAMPLE_COUNT * CHANNEL_COUNT, INPUT_SEED + 30u);
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(SAMPLE_COUNT, INPUT_SEED + 31u);
+
+        // Records written, read back and replayed into a column capture of the rates
+        Host::CaptureFile Records;
+
+        UNIT_CHECK(Records.Create(RECORDS_PATH, Host::CAPTURE_LAYOUT_RECORDS, 1u, SAMPLE_COUNT));
+
+        Host::CaptureRecord * pRecords = Records.GetWritableRecords();
+
+        UNIT_CHECK((pRecords != 0) && (Records.GetTimestampsUs() == 0) && (Records.GetValues(0u) == 0));
+
+        for (uint32_t ulIndex = 0; (pRecords != 0) && (ulIndex < SAMPLE_COUNT); ++ulIndex)
+        {
+            pRecords[ulIndex].ulTimestampUs = aulTimestampsUs[ulIndex];
+            pRecords[ulIndex].fValue = afValues[ulIndex];
+        }
+
+        Records.Close();
+
+        UNIT_CHECK(Host::ReplayRateOfChange(RECORDS_PATH, RATES_PATH));
+
+        Host::CaptureFile Input;
+        Host::CaptureFile Rates;
+
+        UNIT_CHECK(Input.Open(RECORDS_PATH));
+        UNIT_CHECK((Input.GetLayout() == Host::CAPTURE_LAYOUT_RECORDS) && (Input.GetChannelCount() == 1u));
+        UNIT_CHECK(Input.GetSampleCount() == SAMPLE_COUNT);
+        UNIT_CHECK((Input.GetRecords() != 0) && (Input.GetWritableRecords() == 0));
+        UNIT_CHECK(Rates.Open(RATES_PATH));
+        UNIT_CHECK((Rates.GetLayout() == Host::CAPTURE_LAYOUT_COLUMNS) && (Rates.GetChannelCount() == 1u));
+        UNIT_CHECK(Rates.GetSampleCount() == SAMPLE_COUNT);
+
+        if ((Input.GetRecords() != 0) && (Rates.GetValues(0u) != 0))
+        {
+            SignalChain::RateOfChange Serial;
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                const Host::CaptureRecord & rRecord = Input.GetRecords()[ulIndex];
+
+                UNIT_CHECK(rRecord.ulTimestampUs == aulTimestampsUs[ulIndex]);
+                UNIT_CHECK(App::FloatToBits(rRecord.fValue) == App::FloatToBits(afValues[ulIndex]));
+                UNIT_CHECK(Rates.GetTimestampsUs()[ulIndex] == aulTimestampsUs[ulIndex]);
+                UNIT_CHECK(IsSameFloat(Rates.GetValues(0u)[ulIndex],
+                                       Serial.CalcRateOfChangeUs(rRecord.fValue, rRecord.ulTimestampUs)));
+            }
+        }
+
+        Input.Close();
+        Rates.Close();
+
+        // Columns written and read back, each column aligned for the vector loads
+        Host::CaptureFile Columns;
+
+        UNIT_CHECK(Columns.Create(COLUMNS_PATH, Host::CAPTURE_LAYOUT_COLUMNS, CHANNEL_COUNT, SAMPLE_COUNT));
+        UNIT_CHECK(Columns.GetRecords() == 0);
+
+        if (Columns.GetWritableTimestampsUs() != 0)
+        {
+            memcpy(Columns.GetWritableTimestampsUs(), aulTimestampsUs.data(), SAMPLE_COUNT * sizeof(uint32_t));
+
+            for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+            {
+                memcpy(Columns.GetWritableValues(ulChannel), afValues.data() + (ulChannel * SAMPLE_COUNT),
+                       SAMPLE_COUNT * sizeof(float));
+            }
+        }
+
+        Columns.Close();
+
+        UNIT_CHECK(Input.Open(COLUMNS_PATH));
+        UNIT_CHECK((Input.GetLayout() == Host::CAPTURE_LAYOUT_COLUMNS) && (Input.GetChannelCount() == CHANNEL_COUNT));
+        UNIT_CHECK((Input.GetWritableTimestampsUs() == 0) && (Input.GetWritableValues(0u) == 0));
+
+        if (Input.GetTimestampsUs() != 0)
+        {
+            UNIT_CHECK((reinterpret_cast<uintptr_t>(Input.GetTimestampsUs()) % Host::CAPTURE_COLUMN_ALIGNMENT) == 0u);
+            UNIT_CHECK(memcmp(Input.GetTimestampsUs(), aulTimestampsUs.data(), SAMPLE_COUNT * sizeof(uint32_t)) == 0);
+
+            for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+            {
+                const float * pfColumn = Input.GetValues(ulChannel);
+
+                UNIT_CHECK((reinterpret_cast<uintptr_t>(pfColumn) % Host::CAPTURE_COLUMN_ALIGNMENT) == 0u);
+                UNIT_CHECK(memcmp(pfColumn, afValues.data() + (ulChannel * SAMPLE_COUNT),
+                                  SAMPLE_COUNT * sizeof(float)) == 0);
+            }
+        }
+
+        Input.Close();
+
+        // A file cut short or with the wrong magic is rejected
+        uint64_t ullColumnsSize = Host::CaptureFile::GetFileSize(Host::CAPTURE_LAYOUT_COLUMNS, CHANNEL_COUNT,
+                                                                 SAMPLE_COUNT);
+
+        UNIT_CHECK(truncate(COLUMNS_PATH, static_cast<off_t>(ullColumnsSize - 1u)) == 0);
+        UNIT_CHECK(!Input.Open(COLUMNS_PATH));
+
+        FILE * pFile = fopen(RECORDS_PATH, "r+b");
+
+        UNIT_CHECK(pFile != NULL);
+
+        if (pFile != NULL)
+        {
+            fputc('X', pFile);
+            fclose(pFile);
+        }
+
+        UNIT_CHECK(!Input.Open(RECORDS_PATH));
+
+        remove(RECORDS_PATH);
+        remove(COLUMNS_PATH);
+        remove(RATES_PATH);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestOfflineRateEngine
+    ///
+    /// @par Full Description
+    /// Channels cut into chunks at and around the chunk size, run across a pool, against a serial batch over each
+    /// whole channel.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestOfflineRateEngine(void)
+    {
+        static const uint32_t CHANNEL_SAMPLES[] = { 0u, 1u, 2u, 63u, 64u, 65u, 1000u, 4099u };
+        const uint32_t CHANNEL_COUNT = sizeof(CHANNEL_SAMPLES) / sizeof(CHANNEL_SAMPLES[0]);
+        const uint32_t MAX_SAMPLES = 4099u;
+
+        // The timestamps are shared between channels, as in a column capture
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(MAX_SAMPLES, INPUT_SEED + 4u);
+        std::vector<std::vector<float> > aafValues;
+        std::vector<std::vector<float> > aafRates(CHANNEL_COUNT, std::vector<float>(MAX_SAMPLES));
+        std::vector<Host::OfflineChannel> aChannels(CHANNEL_COUNT);
+
+        for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+        {
+            aafValues.push_back(MakeMixedFloats(MAX_SAMPLES, INPUT_SEED + 5u + ulChannel));
+
+            aChannels[ulChannel].pfValues = aafValues[ulChannel].data();
+            aChannels[ulChannel].pulTimestampsUs = aulTimestampsUs.data();
+            aChannels[ulChannel].pfRates = aafRates[ulChannel].data();
+            aChannels[ulChannel].ullSampleCount = CHANNEL_SAMPLES[ulChannel];
+        }
+
+        Host::WorkStealingPool Pool(4u);
+        static const uint32_t CHUNK_SAMPLES[] = { 1u, 64u, 0u };
+
+        for (uint32_t ulChunkSamples : CHUNK_SAMPLES)
+        {
+            Host::OfflineRateEngine Engine(Pool, ulChunkSamples);
+
+            for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+            {
+                std::fill(aafRates[ulChannel].begin(), aafRates[ulChannel].end(), 12345.0f);
+            }
+
+            Engine.CalcRateOfChangeUs(aChannels.data(), CHANNEL_COUNT);
+
+            for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+            {
+                uint32_t ulCount = CHANNEL_SAMPLES[ulChannel];
+                std::vector<float> afExpected(MAX_SAMPLES, 12345.0f);
+                SignalChain::RateOfChange Serial;
+
+                Serial.CalcRateOfChangeUs(aafValues[ulChannel].data(), aulTimestampsUs.data(), afExpected.data(),
+                                          ulCount);
+
+                // Rates past the end of a channel are left alone
+                for (uint32_t ulIndex = 0; ulIndex < MAX_SAMPLES; ++ulIndex)
+                {
+                    UNIT_CHECK(IsSameFloat(aafRates[ulChannel][ulIndex], afExpected[ulIndex]));
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestRateAlarmBank
+    ///
+    /// @par Full Description
+    /// Configuration checks, delay-on, deadband, non finite rates and a full event buffer, on a channel in the
+    /// vector part of the bank and one in the tail.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestRateAlarmBank(void)
+    {
+        const uint32_t CHANNEL_COUNT = 19u;
+
+        SignalChain::StaticRateAlarmBank<CHANNEL_COUNT> Bank;
+        SignalChain::RateAlarmEvent aEvents[CHANNEL_COUNT];
+        float afRates[CHANNEL_COUNT] = { 0.0f };
+
+        UNIT_CHECK(!Bank.SetLimits(CHANNEL_COUNT, -1.0f, 1.0f, 0.0f, 0u));
+        UNIT_CHECK(!Bank.SetLimits(0u, App::FLOAT_NAN, 1.0f, 0.0f, 0u));
+        UNIT_CHECK(!Bank.SetLimits(0u, 2.0f, 1.0f, 0.0f, 0u));
+        UNIT_CHECK(!Bank.SetLimits(0u, -1.0f, 1.0f, -0.5f, 0u));
+        UNIT_CHECK(!Bank.SetLimits(0u, -1.0f, 1.0f, App::FLOAT_INFINITY, 0u));
+        UNIT_CHECK(!Bank.SetLimits(0u, -1.0f, 1.0f, 0.0f, SignalChain::RateAlarmBank::MAX_DELAY_SCANS + 1u));
+
+        // Disabled limits never alarm, whatever the rate
+        afRates[0] = 1.0e30f;
+        afRates[1] = -1.0e30f;
+
+        UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+
+        static const uint32_t CHANNELS[] = { 2u, CHANNEL_COUNT - 1u };
+
+        for (uint32_t ulChannel : CHANNELS)
+        {
+            UNIT_CHECK(Bank.SetLimits(ulChannel, -10.0f, 10.0f, 2.0f, 3u));
+
+            // Two scans above, then a NaN and an infinity restart the count, and neither raises an alarm
+            static const float NOT_RAISED[] = { 11.0f, 11.0f, App::FLOAT_NAN, 11.0f, 11.0f, App::FLOAT_INFINITY,
+                                                11.0f, 11.0f, -App::FLOAT_INFINITY, 10.0f };
+
+            for (float fRate : NOT_RAISED)
+            {
+                afRates[ulChannel] = fRate;
+
+                UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+                UNIT_CHECK(Bank.GetState(ulChannel) == SignalChain::RATE_ALARM_NORMAL);
+            }
+
+            // The third consecutive scan above raises
+            afRates[ulChannel] = 11.0f;
+
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 1u);
+            UNIT_CHECK((aEvents[0].ulChannel == ulChannel) && (aEvents[0].eState == SignalChain::RATE_ALARM_HIGH) &&
+                       (aEvents[0].ePrevious == SignalChain::RATE_ALARM_NORMAL) && (aEvents[0].fRate == 11.0f));
+
+            // Held above the limit less the deadband and through non finite rates, cleared at it
+            static const float HELD[] = { 8.5f, App::FLOAT_NAN, -App::FLOAT_INFINITY, nextafterf(8.0f, 9.0f) };
+
+            for (float fRate : HELD)
+            {
+                afRates[ulChannel] = fRate;
+
+                UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+                UNIT_CHECK(Bank.GetState(ulChannel) == SignalChain::RATE_ALARM_HIGH);
+            }
+
+            afRates[ulChannel] = 8.0f;
+
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 1u);
+            UNIT_CHECK((aEvents[0].eState == SignalChain::RATE_ALARM_NORMAL) &&
+                       (aEvents[0].ePrevious == SignalChain::RATE_ALARM_HIGH));
+
+            // The low alarm mirrors the high one
+            afRates[ulChannel] = -11.0f;
+
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 0u);
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 1u);
+            UNIT_CHECK(Bank.GetState(ulChannel) == SignalChain::RATE_ALARM_LOW);
+
+            afRates[ulChannel] = -8.0f;
+
+            UNIT_CHECK(Bank.Evaluate(afRates, aEvents, CHANNEL_COUNT) == 1u);
+            UNIT_CHECK(Bank.GetState(ulChannel) == SignalChain::RATE_ALARM_NORMAL);
+
+            afRates[ulChannel] = 0.0f;
+        }
+
+        //
+        // With room for one event, the second channel due waits for the next scan.  Reset returns both to normal
+        // without events.
+        //
+        UNIT_CHECK(Bank.SetLimits(2u, -10.0f, 10.0f, 0.0f, 1u));
+        UNIT_CHECK(Bank.SetLimits(CHANNEL_COUNT - 1u, -10.0f, 10.0f, 0.0f, 1u));
+
+        afRates[2] = 20.0f;
+        afRates[CHANNEL_COUNT - 1u] = -20.0f;
+
+        UNIT_CHECK(Bank.Evaluate(afRates, aEvents, 1u) == 1u);
+        UNIT_CHECK(aEvents[0].ulChannel == 2u);
+        UNIT_CHECK(Bank.GetState(CHANNEL_COUNT - 1u) == SignalChain::RATE_ALARM_NORMAL);
+        UNIT_CHECK(Bank.Evaluate(afRates, aEvents, 1u) == 1u);
+        UNIT_CHECK(aEvents[0].ulChannel == (CHANNEL_COUNT - 1u));
+        UNIT_CHECK(Bank.GetState(CHANNEL_COUNT - 1u) == SignalChain::RATE_ALARM_LOW);
+
+        Bank.Reset();
+
+        UNIT_CHECK(Bank.GetState(2u) == SignalChain::RATE_ALARM_NORMAL);
+        UNIT_CHECK(Bank.GetState(CHANNEL_COUNT - 1u) == SignalChain::RATE_ALARM_NORMAL);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestSignalPipeline
+    ///
+    /// @par Full Description
+    /// RateStage bit for bit against BasicRateOfChange on two time bases, SecondDerivativeStage against the
+    /// difference of successive rates, and ProcessBuffer, in place and in uneven batches, against Process.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestSignalPipeline(void)
+    {
+        const uint32_t SAMPLE_COUNT = 2053u;
+
+        std::vector<float> afValues = MakeMixedFloats(SAMPLE_COUNT, INPUT_SEED + 50u);
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(SAMPLE_COUNT, INPUT_SEED + 51u);
+
+        // The rate stage on the microsecond and nanosecond time bases, in seconds and milliseconds
+        SignalChain::SignalPipeline<SignalChain::RateStage<SignalChain::RateUnitSec> > RatePipeline;
+        SignalChain::BasicSignalPipeline<SignalChain::TimeBaseNs64,
+                                         SignalChain::RateStage<SignalChain::RateUnitMs> > NsRatePipeline;
+        SignalChain::BasicRateOfChange<SignalChain::TimeBaseUs32> Rate;
+        SignalChain::BasicRateOfChange<SignalChain::TimeBaseNs64> NsRate;
+        uint64_t ullTimestampNs = 0xFFFFFFFF00000000ull;
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            float fValue = afValues[ulIndex];
+            float fExpected = Rate.CalcRateOfChange<SignalChain::RateUnitSec>(fValue, aulTimestampsUs[ulIndex]);
+            float fNsExpected = NsRate.CalcRateOfChange<SignalChain::RateUnitMs>(fValue, ullTimestampNs);
+
+            UNIT_CHECK(App::FloatToBits(RatePipeline.Process(fValue, aulTimestampsUs[ulIndex])) ==
+                       App::FloatToBits(fExpected));
+            UNIT_CHECK(App::FloatToBits(NsRatePipeline.Process(fValue, ullTimestampNs)) ==
+                       App::FloatToBits(fNsExpected));
+
+            ullTimestampNs += (ulIndex % 7u) * 333333u;
+        }
+
+        //
+        // The second derivative of a parabola sampled every millisecond with a repeated timestamp: 0 until there are
+        // two real rates, then the difference of successive rates over the elapsed time, infinite on the repeat.
+        //
+        typedef SignalChain::SignalPipeline<SignalChain::RateStage<SignalChain::RateUnitSec>,
+                                            SignalChain::SecondDerivativeStage> Derivatives;
+
+        const float SECONDS_PER_TICK = static_cast<float>(1.0 / 1000000.0);
+
+        Derivatives SecondDerivative;
+        SignalChain::RateOfChange Reference;
+        float fPreviousRate = 0.0f;
+        uint32_t ulTimestampUs = 0xFFFFFFFFu - 20000u;
+
+        for (uint32_t ulIndex = 0; ulIndex < 100u; ++ulIndex)
+        {
+            uint32_t ulElapsedUs = ((ulIndex == 0u) || (ulIndex == 50u)) ? 0u : 1000u;
+            float fTime = static_cast<float>(ulIndex) * 0.001f;
+            float fValue = fTime * fTime;
+
+            ulTimestampUs += ulElapsedUs;
+
+            float fRate = Reference.CalcRateOfChangeSec(fValue, ulTimestampUs);
+            float fOutput = SecondDerivative.Process(fValue, ulTimestampUs);
+            float fElapsed = static_cast<float>(ulElapsedUs) * SECONDS_PER_TICK;
+            float fExpected = (ulIndex < 2u) ? 0.0f : ((ulElapsedUs == 0u) ? App::FLOAT_INFINITY :
+                                                       ((fRate - fPreviousRate) / fElapsed));
+
+            UNIT_CHECK(IsSameFloat(fOutput, fExpected));
+            UNIT_CHECK((ulIndex < 2u) || (ulIndex == 50u) || (ulIndex == 51u) || IsNear(fOutput, 2.0f, 0.01f));
+
+            fPreviousRate = fRate;
+        }
+
+        // The full chain over buffers, one sample at a time, in uneven batches and in place, and after a Reset
+        typedef SignalChain::SignalPipeline<SignalChain::SanitizeStage, SignalChain::ScaleStage,
+                                            SignalChain::RateStage<SignalChain::RateUnitSec>,
+                                            SignalChain::SecondDerivativeStage, SignalChain::LowPassStage> Chain;
+
+        const Chain Configured(SignalChain::SanitizeStage(), SignalChain::ScaleStage(2.0f, 1.0f),
+                               SignalChain::RateStage<SignalChain::RateUnitSec>(),
+                               SignalChain::SecondDerivativeStage(), SignalChain::LowPassStage(0.25f));
+        Chain Single(Configured);
+        Chain Batched(Configured);
+        Chain InPlace(Configured);
+        std::vector<float> afExpected(SAMPLE_COUNT);
+        std::vector<float> afOutputs(SAMPLE_COUNT);
+        std::vector<float> afInPlace(afValues);
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            afExpected[ulIndex] = Single.Process(afValues[ulIndex], aulTimestampsUs[ulIndex]);
+        }
+
+        for (uint32_t ulStart = 0, ulBatch = 1; ulStart < SAMPLE_COUNT; ulStart += ulBatch, ulBatch += 3u)
+        {
+            uint32_t ulCount = (ulBatch < (SAMPLE_COUNT - ulStart)) ? ulBatch : (SAMPLE_COUNT - ulStart);
+
+            Batched.ProcessBuffer(afValues.data() + ulStart, aulTimestampsUs.data() + ulStart,
+                                  afOutputs.data() + ulStart, ulCount);
+        }
+
+        InPlace.ProcessBuffer(afInPlace.data(), aulTimestampsUs.data(), afInPlace.data(), SAMPLE_COUNT);
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            UNIT_CHECK(App::FloatToBits(afOutputs[ulIndex]) == App::FloatToBits(afExpected[ulIndex]));
+            UNIT_CHECK(App::FloatToBits(afInPlace[ulIndex]) == App::FloatToBits(afExpected[ulIndex]));
+        }
+
+        Batched.Reset();
+        Batched.ProcessBuffer(afValues.data(), aulTimestampsUs.data(), afOutputs.data(), SAMPLE_COUNT);
+
+        UNIT_CHECK(memcmp(afOutputs.data(), afExpected.data(), SAMPLE_COUNT * sizeof(float)) == 0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestMultiHorizonRateOfChange
+    ///
+    /// @par Full Description
+    /// Several horizons of a ramp sampled every millisecond across the overflow: the shortest is the rate between
+    /// samples, the 10 ms one the change over ten samples, and a repeated timestamp never gives infinity.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestMultiHorizonRateOfChange(void)
+    {
+        const uint32_t aulHorizonsUs[2] = { 1u, 10000u };
+        SignalChain::MultiHorizonRateOfChange<2, 8, 4> Horizons(aulHorizonsUs);
+        SignalChain::RateOfChange Adjacent;
+        float afHorizonRates[2];
+        uint32_t ulTimestampUs = 0xFFFFFFFFu - 50000u;
+
+        for (uint32_t ulIndex = 0; ulIndex < 200u; ++ulIndex)
+        {
+            float fValue = static_cast<float>(ulIndex) * 0.25f;
+
+            Horizons.CalcRatesUs(fValue, ulTimestampUs, afHorizonRates);
+
+            UNIT_CHECK(IsSameFloat(afHorizonRates[0], Adjacent.CalcRateOfChangeUs(fValue, ulTimestampUs)));
+            UNIT_CHECK((ulIndex < 10u) ? (afHorizonRates[1] == 0.0f) : IsNear(afHorizonRates[1], 0.00025f, 1.0e-6f));
+
+            ulTimestampUs += 1000u;
+        }
+
+        Horizons.CalcRatesUs(100.0f, ulTimestampUs - 1000u, afHorizonRates);
+
+        UNIT_CHECK(App::IsFinite(afHorizonRates[0]) && App::IsFinite(afHorizonRates[1]));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestSampleScrubber
+    ///
+    /// @par Full Description
+    /// Each policy against a sample by sample reference, over buffers longer than the vectors, and the counters.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestSampleScrubber(void)
+    {
+        const uint32_t SAMPLE_COUNT = 1029u;
+        const float LOW_LIMIT = -1.0e6f;
+        const float HIGH_LIMIT = 1.0e6f;
+
+        SignalChain::StaticSampleScrubber<3> Scrubber;
+
+        UNIT_CHECK(!Scrubber.SetPolicy(3u, SignalChain::SCRUB_ZERO, 0.0f, 0.0f, false));
+        UNIT_CHECK(!Scrubber.SetPolicy(0u, SignalChain::SCRUB_CLAMP, 1.0f, -1.0f, false));
+        UNIT_CHECK(!Scrubber.SetPolicy(0u, SignalChain::SCRUB_CLAMP, -App::FLOAT_INFINITY, 1.0f, false));
+
+        UNIT_CHECK(Scrubber.SetPolicy(0u, SignalChain::SCRUB_HOLD_LAST_GOOD, LOW_LIMIT, HIGH_LIMIT, true));
+        UNIT_CHECK(Scrubber.SetPolicy(1u, SignalChain::SCRUB_CLAMP, LOW_LIMIT, HIGH_LIMIT, false));
+        UNIT_CHECK(Scrubber.SetPolicy(2u, SignalChain::SCRUB_ZERO, LOW_LIMIT, HIGH_LIMIT, false));
+
+        std::vector<float> afInputs = MakeMixedFloats(SAMPLE_COUNT, INPUT_SEED + 20u);
+
+        for (uint32_t ulChannel = 0; ulChannel < 3u; ++ulChannel)
+        {
+            std::vector<float> afSamples(afInputs);
+            uint32_t aulExpected[4] = { 0u };      // NaN, infinite, subnormal and clamped counts
+            float fLastGood = 0.0f;
+
+            uint32_t ulReplaced = Scrubber.Scrub(ulChannel, afSamples.data(), SAMPLE_COUNT);
+
+            for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+            {
+                float fInput = afInputs[ulIndex];
+                float fExpected = fInput;
+
+                if (App::IsNan(fInput))
+                {
+                    fExpected = (ulChannel == 2u) ? 0.0f : fLastGood;
+                    ++aulExpected[0];
+                }
+                else if (App::IsInf(fInput))
+                {
+                    fExpected = (ulChannel == 0u) ? fLastGood :
+                                (ulChannel == 2u) ? 0.0f : ((fInput > 0.0f) ? HIGH_LIMIT : LOW_LIMIT);
+                    ++aulExpected[1];
+                }
+                else if ((ulChannel == 0u) && App::IsSubnormal(fInput))
+                {
+                    fExpected = copysignf(0.0f, fInput);
+                    ++aulExpected[2];
+                }
+                else if ((ulChannel == 1u) && ((fInput < LOW_LIMIT) || (fInput > HIGH_LIMIT)))
+                {
+                    fExpected = (fInput > 0.0f) ? HIGH_LIMIT : LOW_LIMIT;
+                    ++aulExpected[3];
+                }
+
+                fLastGood = (App::IsFinite(fInput) && (ulChannel != 2u)) ? fExpected : fLastGood;
+
+                UNIT_CHECK(App::FloatToBits(afSamples[ulIndex]) == App::FloatToBits(fExpected));
+            }
+
+            const SignalChain::ScrubChannel & rChannel = Scrubber.GetChannel(ulChannel);
+
+            UNIT_CHECK(rChannel.ulNanCount == aulExpected[0]);
+            UNIT_CHECK(rChannel.ulInfiniteCount == aulExpected[1]);
+            UNIT_CHECK(rChannel.ulSubnormalCount == aulExpected[2]);
+            UNIT_CHECK(rChannel.ulClampedCount == aulExpected[3]);
+            UNIT_CHECK(ulReplaced == (aulExpected[0] + aulExpected[1] + aulExpected[2] + aulExpected[3]));
+        }
+
+        // A flushed subnormal is clamped with the replacements, and counted once, when the limits exclude zero
+        float afFlushed[3] = { App::BitsToFloat(0x80000001u), 1.5f, App::BitsToFloat(0x00000001u) };
+
+        UNIT_CHECK(Scrubber.SetPolicy(1u, SignalChain::SCRUB_CLAMP, 1.0f, 2.0f, true));
+
+        Scrubber.ClearCounters();
+
+        UNIT_CHECK(Scrubber.Scrub(1u, afFlushed, 3u) == 2u);
+        UNIT_CHECK((afFlushed[0] == 1.0f) && (afFlushed[1] == 1.5f) && (afFlushed[2] == 1.0f));
+        UNIT_CHECK(Scrubber.GetChannel(1u).ulSubnormalCount == 2u);
+        UNIT_CHECK(Scrubber.GetChannel(1u).ulClampedCount == 0u);
+        UNIT_CHECK(Scrubber.GetChannel(1u).fLastGood == 1.0f);
+
+        Scrubber.ClearCounters();
+
+        UNIT_CHECK((Scrubber.GetChannel(1u).ulNanCount == 0u) && (Scrubber.GetChannel(1u).ulClampedCount == 0u));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestWatchdogTrace
+    ///
+    /// @par Full Description
+    /// Entries recorded to a mapped trace file, kept across closing and reopening it as they are across a reset,
+    /// and decoded back to the TRACE_BOOT of their run with their ages.  A full ring, a short buffer, and the
+    /// ages across the wrap of the 20 bit entry time.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestWatchdogTrace(void)
+    {
+        const char * const TRACE_PATH = "UnitTests.trace";
+        const CpfBsp::WatchdogWindow Window = { 2000000u, CpfBsp::WINDOW_START_0, CpfBsp::WINDOW_END_100 };
+
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+        CpfBsp::WatchdogTraceEvent aEvents[CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT];
+        CpfBsp::WatchdogResetReport Report;
+        Host::WatchdogTraceFile File;
+
+        remove(TRACE_PATH);
+        rSimulator.PowerOn(Window);
+
+        // Nothing is recorded or decoded without a region
+        CpfBsp::WatchdogTrace::Record(CpfBsp::TRACE_KICK, 1u, 0u);
+
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT) == 0u);
+
+        // A run recorded to a new file
+        UNIT_CHECK(File.Open(TRACE_PATH) && !File.WasKept());
+
+        CpfBsp::WatchdogTrace::RecordBoot(0u);
+        CpfBsp::Watchdog::KickWatchdog(7u, 1000u);
+        CpfBsp::WatchdogTrace::Record(CpfBsp::TRACE_CHECK_IN, 0x1234u, 1600u);
+        CpfBsp::WatchdogTrace::Record(CpfBsp::TRACE_WITHHELD, 5u, 3200u);
+
+        File.Close();
+
+        // The run ends in an underflow, and the next finds the file kept and reads back the run before it
+        rSimulator.AdvanceUs(Window.ulTimeoutUs);
+
+        UNIT_CHECK(File.Open(TRACE_PATH) && File.WasKept());
+        UNIT_CHECK(CpfBsp::WatchdogTrace::ReadResetReport(Report));
+        UNIT_CHECK(Report.uwStatus == CpfBsp::Watchdog::STATUS_UNDERFLOW);
+        UNIT_CHECK(Report.ulEventCount == 4u);
+
+        static const CpfBsp::WatchdogTraceType TYPES[] =
+        {
+            CpfBsp::TRACE_BOOT, CpfBsp::TRACE_KICK, CpfBsp::TRACE_CHECK_IN, CpfBsp::TRACE_WITHHELD
+        };
+        static const uint32_t IDS[] = { 0u, 7u, 0x34u, 5u };
+        static const uint32_t AGES_US[] = { 3200u, 2208u, 1600u, 0u };
+
+        for (uint32_t ulEvent = 0; (ulEvent < Report.ulEventCount) && (ulEvent < 4u); ++ulEvent)
+        {
+            UNIT_CHECK(Report.aEvents[ulEvent].eType == TYPES[ulEvent]);
+            UNIT_CHECK(Report.aEvents[ulEvent].ulId == IDS[ulEvent]);
+            UNIT_CHECK(Report.aEvents[ulEvent].ulAgeUs == AGES_US[ulEvent]);
+        }
+
+        // The new run starts at a boot entry carrying the status, which hides the previous run
+        CpfBsp::WatchdogTrace::RecordBoot(0xFFFFF0u);
+        rSimulator.WriteStatus(0u);
+
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT) == 1u);
+        UNIT_CHECK((aEvents[0].eType == CpfBsp::TRACE_BOOT) &&
+                   (aEvents[0].ulId == (CpfBsp::Watchdog::STATUS_UNDERFLOW >> 8)));
+
+        // Ages carry across the wrap of the entry time, and a short buffer keeps the newest entries
+        CpfBsp::WatchdogTrace::Record(CpfBsp::TRACE_KICK, 1u, 0x1000000u + 0x20u);
+
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, 1u) == 1u);
+        UNIT_CHECK((aEvents[0].eType == CpfBsp::TRACE_KICK) && (aEvents[0].ulAgeUs == 0u));
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT) == 2u);
+        UNIT_CHECK((aEvents[0].eType == CpfBsp::TRACE_BOOT) && (aEvents[0].ulAgeUs == 0x30u));
+
+        // Once the ring is full the boot entry is overwritten and the whole ring decodes
+        for (uint32_t ulKick = 0; ulKick < CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT; ++ulKick)
+        {
+            CpfBsp::WatchdogTrace::Record(CpfBsp::TRACE_KICK, ulKick, 0x2000000u + (ulKick * 16u));
+        }
+
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT) ==
+                   CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT);
+        UNIT_CHECK(aEvents[0].ulId == 0u);
+        UNIT_CHECK(aEvents[0].ulAgeUs == ((CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT - 1u) * 16u));
+
+        File.Close();
+
+        UNIT_CHECK(CpfBsp::WatchdogTrace::Decode(aEvents, CpfBsp::WATCHDOG_TRACE_ENTRY_COUNT) == 0u);
+
+        remove(TRACE_PATH);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestWatchdogPolicy
+    ///
+    /// @par Full Description
+    /// The window edges of the compile time policies allowing for the clock tolerance, and a loop kicker refreshing
+    /// the simulated IWDT.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestWatchdogPolicy(void)
+    {
+        CheckPolicyWindow<ExampleConfig>();
+        CheckPolicyWindow<ExactConfig>();
+        CheckPolicyWindow<LateConfig>();
+
+        typedef CpfBsp::WatchdogPolicy<ExactConfig> ExactPolicy;
+
+        // On an exact clock only the rounding differs, the open edge rounded up rather than down
+        UNIT_CHECK((ExactPolicy::SAFE_OPEN_US - ExactPolicy::OPEN_US) <= 1u);
+        UNIT_CHECK(ExactPolicy::SAFE_CLOSE_US == ExactPolicy::CLOSE_US);
+
+        //
+        // A 1 ms loop refreshing through the example policy, on the simulator: every refresh in the nominal window
+        // and the watchdog never expiring.
+        //
+        typedef CpfBsp::WatchdogPolicy<ExampleConfig> ExamplePolicy;
+        typedef CpfBsp::PeriodicKicker<ExamplePolicy, 1000u, 100u> Kicker;
+
+        UNIT_CHECK(Kicker::KICK_EVERY == 2697u);
+
+        Host::IWdtSimulator & rSimulator = Host::IWdtSimulator::GetInstance();
+        Kicker LoopKicker;
+        uint32_t ulKicks = 0;
+
+        rSimulator.PowerOn(ExamplePolicy::GetWindow());
+
+        for (uint32_t ulPass = 0; ulPass < 30000u; ++ulPass)
+        {
+            rSimulator.AdvanceUs(1000u);
+            ulKicks += LoopKicker.Tick(ulPass * 1000u) ? 1u : 0u;
+        }
+
+        UNIT_CHECK(ulKicks == (30000u / Kicker::KICK_EVERY));
+        UNIT_CHECK(rSimulator.GetRefreshCount() == ulKicks);
+        UNIT_CHECK(rSimulator.GetResetCount() == 0u);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestChannelRegistry
+    ///
+    /// @par Full Description
+    /// Handles going stale on Destroy and Clear, slot reuse, packing and the generation overflow.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestChannelRegistry(void)
+    {
+        SignalChain::ChannelRegistry<RegistryEntry, 4> Registry;
+        SignalChain::ChannelHandle atHandles[4];
+
+        for (uint32_t ulId = 0; ulId < 4u; ++ulId)
+        {
+            atHandles[ulId] = Registry.Create(ulId);
+
+            UNIT_CHECK(atHandles[ulId] != SignalChain::INVALID_CHANNEL_HANDLE);
+            UNIT_CHECK(Registry.Get(atHandles[ulId])->ulId == ulId);
+        }
+
+        UNIT_CHECK(Registry.Create(99u) == SignalChain::INVALID_CHANNEL_HANDLE);
+        UNIT_CHECK(Registry.GetCount() == 4u);
+        UNIT_CHECK(Registry.Get(SignalChain::INVALID_CHANNEL_HANDLE) == 0);
+        UNIT_CHECK(Registry.Get(atHandles[0] | 0xFFFFu) == 0);
+
+        // Destroying moves the last channel into the hole, its handle following it, and the old handle goes stale
+        UNIT_CHECK(Registry.Destroy(atHandles[1]));
+        UNIT_CHECK(!Registry.Destroy(atHandles[1]));
+        UNIT_CHECK(!Registry.IsValid(atHandles[1]));
+        UNIT_CHECK(Registry.GetCount() == 3u);
+        UNIT_CHECK(Registry.GetChannels()[1].ulId == 3u);
+        UNIT_CHECK(Registry.Get(atHandles[3]) == (Registry.GetChannels() + 1));
+
+        for (uint32_t ulIndex = 0; ulIndex < Registry.GetCount(); ++ulIndex)
+        {
+            UNIT_CHECK(Registry.Get(Registry.GetHandle(ulIndex)) == (Registry.GetChannels() + ulIndex));
+        }
+
+        // The freed slot is reused under a new generation, which the old handle does not match
+        SignalChain::ChannelHandle tReused = Registry.Create(10u);
+
+        UNIT_CHECK((tReused & 0xFFFFu) == (atHandles[1] & 0xFFFFu));
+        UNIT_CHECK(tReused != atHandles[1]);
+        UNIT_CHECK(Registry.Get(atHandles[1]) == 0);
+        UNIT_CHECK(Registry.Get(tReused)->ulId == 10u);
+
+        Registry.Clear();
+
+        UNIT_CHECK(Registry.GetCount() == 0u);
+        UNIT_CHECK(!Registry.IsValid(tReused) && !Registry.IsValid(atHandles[0]) && !Registry.IsValid(atHandles[3]));
+
+        // A slot's generation wraps past 0, so a handle is never the invalid handle and is stale once destroyed
+        SignalChain::ChannelRegistry<RegistryEntry, 1> Single;
+        SignalChain::ChannelHandle tPrevious = SignalChain::INVALID_CHANNEL_HANDLE;
+
+        for (uint32_t ulCycle = 0; ulCycle < 70000u; ++ulCycle)
+        {
+            SignalChain::ChannelHandle tHandle = Single.Create(ulCycle);
+
+            UNIT_CHECK(tHandle != SignalChain::INVALID_CHANNEL_HANDLE);
+            UNIT_CHECK(tHandle != tPrevious);
+            UNIT_CHECK(Single.Get(tPrevious) == 0);
+            UNIT_CHECK(Single.Destroy(tHandle));
+            UNIT_CHECK(Single.Get(tHandle) == 0);
+
+            tPrevious = tHandle;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestCompactFormats
+    ///
+    /// @par Full Description
+    /// Float16 and BFloat16: every encoding decoded by the array and scalar conversions and encoded back, the array
+    /// encodings against the scalar ones, and the rounding and overflow cases by hand.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestCompactFormats(void)
+    {
+        const uint32_t ENCODING_COUNT = 0x10000u;
+
+        std::vector<App::Float16> atHalves(ENCODING_COUNT);
+        std::vector<App::BFloat16> atBrains(ENCODING_COUNT);
+        std::vector<float> afDecoded(ENCODING_COUNT);
+
+        for (uint32_t ulBits = 0; ulBits < ENCODING_COUNT; ++ulBits)
+        {
+            atHalves[ulBits].uwBits = static_cast<uint16_t>(ulBits);
+            atBrains[ulBits].uwBits = static_cast<uint16_t>(ulBits);
+        }
+
+        // Every Float16 decodes exactly and encodes back to itself, a NaN coming back quiet and a subnormal normal
+        App::Float16ToFloat(atHalves.data(), afDecoded.data(), ENCODING_COUNT);
+
+        for (uint32_t ulBits = 0; ulBits < ENCODING_COUNT; ++ulBits)
+        {
+            float fValue = App::Float16ToFloat(atHalves[ulBits]);
+            uint32_t ulQuiet = App::IsNan(fValue) ? 0x0200u : 0u;
+
+            UNIT_CHECK(App::FloatToBits(afDecoded[ulBits]) == App::FloatToBits(fValue));
+            UNIT_CHECK(App::FloatToFloat16(fValue).uwBits == (ulBits | ulQuiet));
+            UNIT_CHECK(App::FpClassify(fValue) ==
+                       (App::IsSubnormal(atHalves[ulBits]) ? App::FLP_NORMAL : App::FpClassify(atHalves[ulBits])));
+        }
+
+        // Every BFloat16 is the top half of its float
+        App::BFloat16ToFloat(atBrains.data(), afDecoded.data(), ENCODING_COUNT);
+
+        for (uint32_t ulBits = 0; ulBits < ENCODING_COUNT; ++ulBits)
+        {
+            float fValue = App::BFloat16ToFloat(atBrains[ulBits]);
+            uint32_t ulQuiet = App::IsNan(fValue) ? 0x0040u : 0u;
+
+            UNIT_CHECK(App::FloatToBits(afDecoded[ulBits]) == (ulBits << 16));
+            UNIT_CHECK(App::FloatToBits(fValue) == (ulBits << 16));
+            UNIT_CHECK(App::FloatToBFloat16(fValue).uwBits == (ulBits | ulQuiet));
+            UNIT_CHECK(App::FpClassify(fValue) == App::FpClassify(atBrains[ulBits]));
+        }
+
+        // Array encodings of floats of every class, including the tail lengths, against the scalar encodings
+        std::vector<float> afInputs = MakeMixedFloats(4099u, INPUT_SEED + 1u);
+        std::vector<App::Float16> atHalfOutputs(afInputs.size());
+        std::vector<App::BFloat16> atBrainOutputs(afInputs.size());
+
+        App::FloatToFloat16(afInputs.data(), atHalfOutputs.data(), static_cast<uint32_t>(afInputs.size()));
+        App::FloatToBFloat16(afInputs.data(), atBrainOutputs.data(), static_cast<uint32_t>(afInputs.size()));
+
+        for (uint32_t ulIndex = 0; ulIndex < afInputs.size(); ++ulIndex)
+        {
+            UNIT_CHECK(atHalfOutputs[ulIndex].uwBits == App::FloatToFloat16(afInputs[ulIndex]).uwBits);
+            UNIT_CHECK(atBrainOutputs[ulIndex].uwBits == App::FloatToBFloat16(afInputs[ulIndex]).uwBits);
+        }
+
+        // Float16 rounding to nearest even, overflow from 65520 and underflow below half the smallest subnormal
+        UNIT_CHECK(App::FloatToFloat16(1.0f).uwBits == 0x3C00u);
+        UNIT_CHECK(App::FloatToFloat16(-2.0f).uwBits == 0xC000u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x3F801000u)).uwBits == 0x3C00u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x3F803000u)).uwBits == 0x3C02u);
+        UNIT_CHECK(App::FloatToFloat16(65504.0f).uwBits == 0x7BFFu);
+        UNIT_CHECK(App::FloatToFloat16(65519.0f).uwBits == 0x7BFFu);
+        UNIT_CHECK(App::FloatToFloat16(65520.0f).uwBits == 0x7C00u);
+        UNIT_CHECK(App::FloatToFloat16(-1.0e10f).uwBits == 0xFC00u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x38800000u)).uwBits == 0x0400u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x33800000u)).uwBits == 0x0001u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x33000000u)).uwBits == 0x0000u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x33400000u)).uwBits == 0x0001u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x80000001u)).uwBits == 0x8000u);
+        UNIT_CHECK(App::FloatToFloat16(App::BitsToFloat(0x7F800001u)).uwBits == 0x7E00u);
+
+        // BFloat16 rounding to nearest even, and only the largest floats rounding up to infinity
+        UNIT_CHECK(App::FloatToBFloat16(1.0f).uwBits == 0x3F80u);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x3F808000u)).uwBits == 0x3F80u);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x3F818000u)).uwBits == 0x3F82u);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x3F808001u)).uwBits == 0x3F81u);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x7F7F7FFFu)).uwBits == 0x7F7Fu);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x7F7FFFFFu)).uwBits == 0x7F80u);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x00018000u)).uwBits == 0x0002u);
+        UNIT_CHECK(App::FloatToBFloat16(App::BitsToFloat(0x7F800001u)).uwBits == 0x7FC0u);
+
+        // A history filled a block at a time holds what single pushes would have, the oldest overwritten
+        SignalChain::CompactHistory<App::Float16, 64> BlockHistory;
+        SignalChain::CompactHistory<App::Float16, 64> SingleHistory;
+
+        BlockHistory.Push(afInputs.data(), 50u);
+        BlockHistory.Push(afInputs.data() + 50u, 45u);
+
+        for (uint32_t ulIndex = 0; ulIndex < 95u; ++ulIndex)
+        {
+            SingleHistory.Push(afInputs[ulIndex]);
+        }
+
+        UNIT_CHECK(BlockHistory.GetCount() == 64u);
+        UNIT_CHECK(SingleHistory.GetCount() == 64u);
+
+        for (uint32_t ulAge = 0; ulAge < 64u; ++ulAge)
+        {
+            UNIT_CHECK(BlockHistory.GetEncoded(ulAge).uwBits == SingleHistory.GetEncoded(ulAge).uwBits);
+            UNIT_CHECK(BlockHistory.GetEncoded(ulAge).uwBits == App::FloatToFloat16(afInputs[94u - ulAge]).uwBits);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestLazyRateOfChange
+    ///
+    /// @par Full Description
+    /// The rate read after every sample against the streaming RateOfChange, across the timestamp overflow and on
+    /// repeated timestamps.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestLazyRateOfChange(void)
+    {
+        const uint32_t SAMPLE_COUNT = 4099u;
+
+        std::vector<float> afValues = MakeMixedFloats(SAMPLE_COUNT, INPUT_SEED + 2u);
+        std::vector<uint32_t> aulTimestampsUs = MakeTimestamps(SAMPLE_COUNT, INPUT_SEED + 3u);
+
+        SignalChain::LazyRateOfChange<SignalChain::RateUnitUs> Lazy;
+        SignalChain::RateOfChange Streamed;
+
+        UNIT_CHECK(Lazy.GetRate() == 0.0f);
+
+        for (uint32_t ulIndex = 0; ulIndex < SAMPLE_COUNT; ++ulIndex)
+        {
+            Lazy.Record(afValues[ulIndex], aulTimestampsUs[ulIndex]);
+
+            UNIT_CHECK(IsSameFloat(Lazy.GetRate(), Streamed.CalcRateOfChangeUs(afValues[ulIndex],
+                                                                               aulTimestampsUs[ulIndex])));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestRateExceptionReporter
+    ///
+    /// @par Full Description
+    /// First reports, the closed deadband, the percentage deadband, NaN and infinity, heartbeats and a full list.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestRateExceptionReporter(void)
+    {
+        const uint32_t CHANNEL_COUNT = 11u;
+        const uint32_t CHANNEL = CHANNEL_COUNT - 1u;
+
+        SignalChain::StaticRateExceptionReporter<CHANNEL_COUNT> Reporter;
+        uint32_t aulChanged[CHANNEL_COUNT];
+        float afRates[CHANNEL_COUNT] = { 0.0f };
+
+        UNIT_CHECK(!Reporter.SetDeadband(CHANNEL_COUNT, 1.0f, 0.0f, 0u));
+        UNIT_CHECK(!Reporter.SetDeadband(0u, -1.0f, 0.0f, 0u));
+        UNIT_CHECK(!Reporter.SetDeadband(0u, 1.0f, App::FLOAT_NAN, 0u));
+
+        for (uint32_t ulChannel = 0; ulChannel < CHANNEL_COUNT; ++ulChannel)
+        {
+            UNIT_CHECK(Reporter.SetDeadband(ulChannel, 1.0f, 0.0f, 0u));
+        }
+
+        // Every channel on the first scan, in order, then nothing while the rates stay put
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == CHANNEL_COUNT);
+        UNIT_CHECK((aulChanged[0] == 0u) && (aulChanged[CHANNEL] == CHANNEL));
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == 0u);
+
+        // The deadband is closed, a change of exactly the deadband is not reported
+        afRates[CHANNEL] = 1.0f;
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == 0u);
+
+        afRates[CHANNEL] = nextafterf(1.0f, 2.0f);
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == 1u);
+        UNIT_CHECK((aulChanged[0] == CHANNEL) && (Reporter.GetLastReported(CHANNEL) == afRates[CHANNEL]));
+
+        // A percentage deadband larger than the absolute one takes over
+        UNIT_CHECK(Reporter.SetDeadband(CHANNEL, 1.0f, 10.0f, 0u));
+
+        afRates[CHANNEL] = 100.0f;
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == 1u);
+
+        afRates[CHANNEL] = 109.0f;
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == 0u);
+
+        afRates[CHANNEL] = 111.0f;
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == 1u);
+
+        // Successive NaNs are one NaN, an infinity is reported once, and a finite rate after either is reported
+        static const float NON_FINITE[] = { App::FLOAT_NAN, App::FLOAT_NAN, App::FLOAT_INFINITY, App::FLOAT_INFINITY,
+                                            -App::FLOAT_INFINITY, 5.0f };
+        static const uint32_t REPORTED[] = { 1u, 0u, 1u, 0u, 1u, 1u };
+
+        for (uint32_t ulIndex = 0; ulIndex < (sizeof(REPORTED) / sizeof(REPORTED[0])); ++ulIndex)
+        {
+            afRates[CHANNEL] = NON_FINITE[ulIndex];
+
+            UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == REPORTED[ulIndex]);
+        }
+
+        // An unchanged rate is reported again every heartbeat
+        UNIT_CHECK(Reporter.SetDeadband(CHANNEL, 1.0f, 0.0f, 3u));
+
+        for (uint32_t ulScan = 1; ulScan <= 9u; ++ulScan)
+        {
+            UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == (((ulScan % 3u) == 0u) ? 1u : 0u));
+        }
+
+        //
+        // With room for one channel, the second due is reported on the next scan.  After Reset every channel is
+        // reported again.
+        //
+        UNIT_CHECK(Reporter.SetDeadband(CHANNEL, 1.0f, 0.0f, 0u));
+
+        afRates[1] = 50.0f;
+        afRates[CHANNEL] = 50.0f;
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, 1u) == 1u);
+        UNIT_CHECK(aulChanged[0] == 1u);
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, 1u) == 1u);
+        UNIT_CHECK(aulChanged[0] == CHANNEL);
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, 1u) == 0u);
+
+        Reporter.Reset();
+
+        UNIT_CHECK(Reporter.Evaluate(afRates, aulChanged, CHANNEL_COUNT) == CHANNEL_COUNT);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TestFixedPeriodRateOfChange
+    ///
+    /// @par Full Description
+    /// The exact path for a repeated timestamp and a missed sample, counted, and the reciprocal within the
+    /// tolerance otherwise, the same in batches as streamed.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TestFixedPeriodRateOfChange(void)
+    {
+        static const uint32_t FIXED_TIMESTAMPS_US[] =
+        {
+            0xFFFFF830u, 0xFFFFFC18u, 0x00000000u, 0x000003E8u, 0x000003E8u, 0x000007D0u, 0x00000FA0u, 0x000013A0u
+        };
+        static const float FIXED_VALUES[] = { 0.0f, 1.0f, 3.0f, 6.0f, 7.0f, 8.0f, 10.0f, 11.0f };
+        const uint32_t FIXED_COUNT = sizeof(FIXED_VALUES) / sizeof(FIXED_VALUES[0]);
+
+        SignalChain::FixedPeriodRateOfChange FixedStreamed(1000u, 24u);
+        SignalChain::FixedPeriodRateOfChange FixedBatched(1000u, 24u);
+        SignalChain::RateOfChange Exact;
+        float afFixedRates[FIXED_COUNT];
+
+        FixedBatched.CalcRateOfChangeUs(FIXED_VALUES, FIXED_TIMESTAMPS_US, afFixedRates, 3u);
+        FixedBatched.CalcRateOfChangeUs(FIXED_VALUES + 3u, FIXED_TIMESTAMPS_US + 3u, afFixedRates + 3u,
+                                        FIXED_COUNT - 3u);
+
+        for (uint32_t ulIndex = 0; ulIndex < FIXED_COUNT; ++ulIndex)
+        {
+            float fRate = FixedStreamed.CalcRateOfChangeUs(FIXED_VALUES[ulIndex], FIXED_TIMESTAMPS_US[ulIndex]);
+            float fExact = Exact.CalcRateOfChangeUs(FIXED_VALUES[ulIndex], FIXED_TIMESTAMPS_US[ulIndex]);
+
+            UNIT_CHECK(IsSameFloat(afFixedRates[ulIndex], fRate));
+
+            // Samples 4 and 6 are off period, sample 7 is 24 us late and still taken as the period
+            if ((ulIndex == 4u) || (ulIndex == 6u))
+            {
+                UNIT_CHECK(IsSameFloat(fRate, fExact));
+            }
+            else if (ulIndex == 7u)
+            {
+                UNIT_CHECK(IsNear(fRate, fExact, 0.025f));
+            }
+            else
+            {
+                UNIT_CHECK(IsNear(fRate, fExact, 1.0e-6f));
+            }
+        }
+
+        UNIT_CHECK(FixedStreamed.GetOffPeriodCount() == 2u);
+        UNIT_CHECK(FixedBatched.GetOffPeriodCount() == 2u);
+    }
+
+    // Every group, in the order they run
+    const UnitTestGroup TEST_GROUPS[] =
+    {
+        { "RateOfChangeBank",          TestRateOfChangeBank },
+        { "RateOfChangeBatch",         TestRateOfChangeBatch },
+        { "RateOfChangeUnits",         TestRateOfChangeUnits },
+        { "FloatLib",                  TestFloatLib },
+        { "FloatClassify",             TestFloatClassify },
+        { "LeastSquaresSlope",         TestLeastSquaresSlope },
+        { "SampleRing",                TestSampleRing },
+        { "WatchdogSupervisor",        TestWatchdogSupervisor },
+        { "KickScheduler",             TestKickScheduler },
+        { "WatchdogMonitor",           TestWatchdogMonitor },
+        { "IWdtSimulator",             TestIWdtSimulator },
+        { "CaptureFile",               TestCaptureFile },
+        { "OfflineRateEngine",         TestOfflineRateEngine },
+        { "RateAlarmBank",             TestRateAlarmBank },
+        { "SignalPipeline",            TestSignalPipeline },
+        { "MultiHorizonRateOfChange",  TestMultiHorizonRateOfChange },
+        { "SampleScrubber",            TestSampleScrubber },
+        { "WatchdogTrace",             TestWatchdogTrace },
+        { "WatchdogPolicy",            TestWatchdogPolicy },
+        { "ChannelRegistry",           TestChannelRegistry },
+        { "CompactFormats",            TestCompactFormats },
+        { "LazyRateOfChange",          TestLazyRateOfChange },
+        { "RateExceptionReporter",     TestRateExceptionReporter },
+        { "FixedPeriodRateOfChange",   TestFixedPeriodRateOfChange }
+    };
+
+    const uint32_t TEST_GROUP_COUNT = sizeof(TEST_GROUPS) / sizeof(TEST_GROUPS[0]);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: RunGroup
+    ///
+    /// @param  [in]  rGroup   Group to run.
+    ///
+    /// @return whether every check of the group passed
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool RunGroup(const UnitTestGroup & rGroup)
+    {
+        g_ulFailures = 0;
+
+        rGroup.pfnRun();
+
+        printf("%-24s %s", rGroup.pszName, (g_ulFailures == 0u) ? "passed\n" : "FAILED");
+
+        if (g_ulFailures != 0u)
+        {
+            printf(", %u checks\n", g_ulFailures);
+        }
+
+        return g_ulFailures == 0u;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// FUNCTION NAME: main
+///
+/// @return 0 when every check passed, 1 on a failed check, 2 on an unknown group
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char * argv[])
+{
+    int iStatus = 0;
+
+    for (int iArg = 1; (iArg < argc) && (iStatus != 2); ++iArg)
+    {
+        uint32_t ulGroup = 0;
+
+        while ((ulGroup < TEST_GROUP_COUNT) && (strcmp(argv[iArg], TEST_GROUPS[ulGroup].pszName) != 0))
+        {
+            ++ulGroup;
+        }
+
+        if (ulGroup == TEST_GROUP_COUNT)
+        {
+            fprintf(stderr, "Usage: %s [GROUP...], unknown group %s\n", argv[0], argv[iArg]);
+
+            iStatus = 2;
+        }
+        else if (!RunGroup(TEST_GROUPS[ulGroup]))
+        {
+            iStatus = 1;
+        }
+    }
+
+    for (uint32_t ulGroup = 0; (argc == 1) && (ulGroup < TEST_GROUP_COUNT); ++ulGroup)
+    {
+        iStatus = RunGroup(TEST_GROUPS[ulGroup]) ? iStatus : 1;
+    }
+
+    return iStatus;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogTraceFile.cpp
+///
+/// @see WatchdogTraceFile.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "WatchdogTraceFile.hpp"
+#include "WatchdogTrace.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogTraceFile::Open
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool WatchdogTraceFile::Open(const char * pszPath)
+    {
+        Close();
+
+        bool bOpened = m_File.OpenReadWrite(pszPath, sizeof(CpfBsp::WatchdogTraceRegion));
+
+        if (bOpened)
+        {
+            // The mapping is page aligned, so the atomics in the region are naturally aligned
+            m_bKept = CpfBsp::WatchdogTrace::Attach(reinterpret_cast<CpfBsp::WatchdogTraceRegion *>(m_File.GetData()));
+        }
+
+        return bOpened;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogTraceFile::Close
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WatchdogTraceFile::Close(void)
+    {
+        if (m_File.GetData() != 0)
+        {
+            CpfBsp::WatchdogTrace::Attach(0);
+
+            m_File.Close();
+        }
+
+        m_bKept = false;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
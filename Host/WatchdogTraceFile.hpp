@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogTraceFile.hpp
+///
+/// Description Host persistent memory for the watchdog trace
+///
+/// @par Full Description
+/// Class header for the WatchdogTraceFile class, which stands in for the .noinit region holding the WatchdogTrace
+/// ring when the board support code is built for a Linux host.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Documented that the file is opened and closed from the recording context
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WATCHDOG_TRACE_FILE_HPP__
+#define __WATCHDOG_TRACE_FILE_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "MappedFile.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WatchdogTraceFile: WatchdogTraceFile
+///
+/// Watchdog trace region kept in a mapped file
+///
+/// @par Full Description
+/// The mapping is shared with the file, so every entry recorded is in the page cache the moment it is stored and
+/// survives the process being killed, just as the .noinit region survives a reset on the target.  Opening the file
+/// in the next run and attaching it gives ReadResetReport the trace of the run before.
+///
+/// The trace is detached when the file is closed, and the mapping then removed, so the file is opened and closed
+/// from the one context that records, or while it is not running, as WatchdogTrace::Attach requires.  Closing it
+/// from another thread while that context records would leave Record writing to unmapped memory.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class WatchdogTraceFile
+{
+    public:
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogTraceFile::WatchdogTraceFile
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WatchdogTraceFile() : m_bKept(false) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogTraceFile::~WatchdogTraceFile
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WatchdogTraceFile() { Close(); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTraceFile::Open
+        ///
+        /// @par Full Description
+        /// Maps the file, creating it if needed, and attaches it to CpfBsp::WatchdogTrace.
+        ///
+        /// @pre    Called from the recording context, or while it is not running.
+        ///
+        /// @param  [in]  pszPath   Trace file.
+        ///
+        /// @return whether the file was mapped and attached
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Open(const char * pszPath);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTraceFile::WasKept
+        ///
+        /// @return whether the file held a trace from an earlier run when it was opened
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool WasKept(void) const { return m_bKept; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTraceFile::Close
+        ///
+        /// @par Full Description
+        /// Detaches the trace and unmaps the file.  Closing a file that is not open has no effect.
+        ///
+        /// @pre    Called from the recording context, or while it is not running, so no Record is still writing to
+        ///         the mapping.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Close(void);
+
+    private:
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        MappedFile m_File;
+
+        // The file held a trace from an earlier run
+        bool       m_bKept;
+
+        // Inhibit copy constructor and assignment operator
+        WatchdogTraceFile(WatchdogTraceFile &);
+
+        WatchdogTraceFile & operator=(WatchdogTraceFile const&); // assign op. hidden
+};
+} //Host;
+
+
+#endif //__WATCHDOG_TRACE_FILE_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
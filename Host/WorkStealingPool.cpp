@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WorkStealingPool.cpp
+///
+/// @see WorkStealingPool.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "WorkStealingPool.hpp"
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WorkStealingPool::WorkStealingPool
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    WorkStealingPool::WorkStealingPool(uint32_t ulWorkerCount)
+        : m_aWorkers((ulWorkerCount != 0u) ? ulWorkerCount :
+                     ((std::thread::hardware_concurrency() != 0u) ? std::thread::hardware_concurrency() : 1u)),
+          m_aThreads(),
+          m_pfnTask(0),
+          m_pContext(0),
+          m_ulPendingTasks(0),
+          m_ulBatch(0),
+          m_bStopping(false)
+    {
+        m_aThreads.reserve(m_aWorkers.size() - 1u);
+
+        for (uint32_t ulWorker = 1u; ulWorker < m_aWorkers.size(); ++ulWorker)
+        {
+            m_aThreads.push_back(std::thread(&WorkStealingPool::ThreadMain, this, ulWorker));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WorkStealingPool::~WorkStealingPool
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    WorkStealingPool::~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> Guard(m_BatchLock);
+
+            m_bStopping = true;
+        }
+
+        m_BatchStarted.notify_all();
+
+        for (uint32_t ulThread = 0; ulThread < m_aThreads.size(); ++ulThread)
+        {
+            m_aThreads[ulThread].join();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WorkStealingPool::Run
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WorkStealingPool::Run(TaskFunction pfnTask, void * pContext, uint32_t ulTaskCount)
+    {
+        if (ulTaskCount != 0u)
+        {
+            uint32_t ulWorkerCount = GetWorkerCount();
+
+            m_pfnTask = pfnTask;
+            m_pContext = pContext;
+            m_ulPendingTasks.store(ulTaskCount);
+
+            // Deal one contiguous range to each worker, queued so that the owner takes its lowest index first
+            for (uint32_t ulWorker = 0; ulWorker < ulWorkerCount; ++ulWorker)
+            {
+                uint32_t ulFirst = static_cast<uint32_t>((static_cast<uint64_t>(ulTaskCount) * ulWorker) /
+                                                         ulWorkerCount);
+                uint32_t ulEnd = static_cast<uint32_t>((static_cast<uint64_t>(ulTaskCount) * (ulWorker + 1u)) /
+                                                       ulWorkerCount);
+
+                std::lock_guard<std::mutex> Guard(m_aWorkers[ulWorker].Lock);
+
+                for (uint32_t ulTask = ulEnd; ulTask > ulFirst; --ulTask)
+                {
+                    m_aWorkers[ulWorker].aulTasks.push_back(ulTask - 1u);
+                }
+            }
+
+            // The batch lock also publishes the task function and context to the pool threads
+            {
+                std::lock_guard<std::mutex> Guard(m_BatchLock);
+
+                ++m_ulBatch;
+            }
+
+            m_BatchStarted.notify_all();
+
+            Work(0u);
+
+            // Wait for tasks still running on the pool threads
+            std::unique_lock<std::mutex> Lock(m_BatchLock);
+
+            while (m_ulPendingTasks.load() != 0u)
+            {
+                m_BatchFinished.wait(Lock);
+            }
+        }
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WorkStealingPool::ThreadMain
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WorkStealingPool::ThreadMain(uint32_t ulWorker)
+    {
+        uint32_t ulBatch = 0;
+        bool bStopping = false;
+
+        while (!bStopping)
+        {
+            {
+                std::unique_lock<std::mutex> Lock(m_BatchLock);
+
+                while ((m_ulBatch == ulBatch) && !m_bStopping)
+                {
+                    m_BatchStarted.wait(Lock);
+                }
+
+                ulBatch = m_ulBatch;
+                bStopping = m_bStopping;
+            }
+
+            if (!bStopping)
+            {
+                Work(ulWorker);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WorkStealingPool::Work
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WorkStealingPool::Work(uint32_t ulWorker)
+    {
+        uint32_t ulTaskIndex = 0;
+
+        while (TakeTask(ulWorker, ulTaskIndex))
+        {
+            m_pfnTask(m_pContext, ulTaskIndex);
+
+            // The last task to finish wakes Run
+            if (m_ulPendingTasks.fetch_sub(1u) == 1u)
+            {
+                std::lock_guard<std::mutex> Guard(m_BatchLock);
+
+                m_BatchFinished.notify_all();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WorkStealingPool::TakeTask
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool WorkStealingPool::TakeTask(uint32_t ulWorker, uint32_t & rulTaskIndex)
+    {
+        uint32_t ulWorkerCount = GetWorkerCount();
+        bool bTaken = false;
+
+        // Own queue first, then the others starting with the next worker so that thieves spread out
+        for (uint32_t ulOffset = 0; (ulOffset < ulWorkerCount) && !bTaken; ++ulOffset)
+        {
+            Worker & rVictim = m_aWorkers[(ulWorker + ulOffset) % ulWorkerCount];
+
+            std::lock_guard<std::mutex> Guard(rVictim.Lock);
+
+            if (!rVictim.aulTasks.empty())
+            {
+                if (ulOffset == 0u)
+                {
+                    rulTaskIndex = rVictim.aulTasks.back();
+                    rVictim.aulTasks.pop_back();
+                }
+                else
+                {
+                    rulTaskIndex = rVictim.aulTasks.front();
+                    rVictim.aulTasks.pop_front();
+                }
+
+                bTaken = true;
+            }
+        }
+
+        return bTaken;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WorkStealingPool.hpp
+///
+/// Description Work stealing thread pool
+///
+/// @par Full Description
+/// Class header for the WorkStealingPool class, which runs batches of independent tasks across the host cores.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup Host
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WORK_STEALING_POOL_HPP__
+#define __WORK_STEALING_POOL_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace Host
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WorkStealingPool: WorkStealingPool
+///
+/// Thread pool running batches of indexed tasks with work stealing
+///
+/// @par Full Description
+/// Run executes a task function once for each index of a batch and returns when all have finished.  The calling
+/// thread works alongside the pool threads, so a pool of N workers starts N - 1 threads.
+///
+/// Each worker has its own queue.  A batch is dealt out as one contiguous range of indices per worker, so
+/// neighbouring tasks tend to run on the same core.  A worker takes tasks from the back of its own queue and, when
+/// that is empty, steals from the front of another worker's queue, taking the tasks its owner would reach last.
+/// Uneven task costs are therefore balanced without any central queue that every worker contends on.
+///
+/// Tasks must not call Run on the same pool.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class WorkStealingPool
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Function run for each task index of a batch
+        typedef void (*TaskFunction)(void * pContext, uint32_t ulTaskIndex);
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WorkStealingPool::WorkStealingPool
+        ///
+        /// @par Full Description
+        /// Constructor
+        ///
+        /// @param  [in]  ulWorkerCount Workers including the calling thread, 0 for one per host core.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WorkStealingPool(uint32_t ulWorkerCount = 0u);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WorkStealingPool::~WorkStealingPool
+        ///
+        /// Destructor, stops and joins the pool threads.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WorkStealingPool();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WorkStealingPool::Run
+        ///
+        /// @par Full Description
+        /// Runs pfnTask(pContext, index) for every index from 0 to ulTaskCount - 1, in no particular order and on any
+        /// worker.
+        ///
+        /// @pre    Not called from a task, nor from two threads at once.
+        /// @post   Every task has finished.
+        ///
+        /// @param  [in]  pfnTask       Task function.
+        /// @param  [in]  pContext      Passed to every task.
+        /// @param  [in]  ulTaskCount   Tasks in the batch.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Run(TaskFunction pfnTask, void * pContext, uint32_t ulTaskCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WorkStealingPool::GetWorkerCount
+        ///
+        /// @return workers including the calling thread
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetWorkerCount(void) const { return static_cast<uint32_t>(m_aWorkers.size()); }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Task queue of one worker
+        struct Worker
+        {
+            std::mutex           Lock;
+            std::deque<uint32_t> aulTasks;
+        };
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WorkStealingPool::ThreadMain
+        ///
+        /// Body of each pool thread, waiting for batches and working on them.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void ThreadMain(uint32_t ulWorker);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WorkStealingPool::Work
+        ///
+        /// Runs tasks from the worker's own queue and then stolen ones until no queue has any left.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Work(uint32_t ulWorker);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WorkStealingPool::TakeTask
+        ///
+        /// Takes a task from the back of the worker's own queue or the front of another's.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool TakeTask(uint32_t ulWorker, uint32_t & rulTaskIndex);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Queues, worker 0 is the thread calling Run
+        std::vector<Worker>      m_aWorkers;
+        std::vector<std::thread> m_aThreads;
+
+        // Current batch
+        TaskFunction             m_pfnTask;
+        void *                   m_pContext;
+        std::atomic<uint32_t>    m_ulPendingTasks;
+
+        // Wakes the pool threads for a new batch or to stop
+        std::mutex               m_BatchLock;
+        std::condition_variable  m_BatchStarted;
+        std::condition_variable  m_BatchFinished;
+        uint32_t                 m_ulBatch;
+        bool                     m_bStopping;
+
+        // Inhibit copy constructor and assignment operator
+        WorkStealingPool(WorkStealingPool &);
+
+        WorkStealingPool & operator=(WorkStealingPool const&); // assign op. hidden
+};
+} //Host;
+
+
+#endif //__WORK_STEALING_POOL_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
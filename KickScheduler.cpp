@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file KickScheduler.cpp
+///
+/// @see KickScheduler.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Refreshes are recorded in the WatchdogTrace
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "KickScheduler.hpp"
+#include "Watchdog.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// KickScheduler::KickScheduler
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    KickScheduler::KickScheduler(const WatchdogWindow & rWindow, uint32_t ulTickUs)
+        : m_Window(rWindow),
+          m_ulTickUs((ulTickUs != 0u) ? ulTickUs : 1u),
+          m_ulMidpointTicks(0),
+          m_ulCycleStartUs(0),
+          m_ulLastTickUs(0),
+          m_ulResidualUs(0),
+          m_bRefreshDue(false),
+          m_ulRefreshCount(0),
+          m_ulMissedCount(0)
+    {
+        m_bKickRequested.store(false, std::memory_order_relaxed);
+
+        m_ulMidpointTicks = m_Window.GetMidpointUs() / m_ulTickUs;
+
+        TimingWheel::InitTimer(m_RefreshTimer, &KickScheduler::OnRefreshDue, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// KickScheduler::Start
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void KickScheduler::Start(uint32_t ulNowUs)
+    {
+        m_ulCycleStartUs = ulNowUs;
+        m_ulLastTickUs = ulNowUs;
+        m_ulResidualUs = 0;
+        m_bRefreshDue = false;
+
+        m_TimingWheel.Schedule(m_RefreshTimer, m_ulMidpointTicks);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// KickScheduler::Tick
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool KickScheduler::Tick(uint32_t ulNowUs)
+    {
+        // Modulo 2^32 subtraction handles a timestamp overflow since the last call
+        uint32_t ulElapsedUs = (ulNowUs - m_ulLastTickUs) + m_ulResidualUs;
+
+        m_ulLastTickUs = ulNowUs;
+        m_ulResidualUs = ulElapsedUs % m_ulTickUs;
+
+        m_TimingWheel.Advance(ulElapsedUs / m_ulTickUs);
+
+        bool bRefreshed = false;
+
+        if (m_bRefreshDue)
+        {
+            uint32_t ulCycleUs = ulNowUs - m_ulCycleStartUs;
+
+            if ((ulCycleUs <= m_Window.GetCloseUs()) &&
+                m_bKickRequested.exchange(false, std::memory_order_relaxed))
+            {
+                Watchdog::KickWatchdog(TRACE_CALLER_SCHEDULER, ulNowUs);
+
+                ++m_ulRefreshCount;
+                bRefreshed = true;
+
+                // The refresh starts a new cycle now, so align the wheel ticks with it
+                Start(ulNowUs);
+            }
+            // Waiting for the next Tick could miss the window, so leave the watchdog to expire
+            else if ((ulCycleUs + m_ulTickUs) > m_Window.GetCloseUs())
+            {
+                ++m_ulMissedCount;
+                m_bRefreshDue = false;
+            }
+        }
+
+        return bRefreshed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// KickScheduler::GetUsToNextEvent
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t KickScheduler::GetUsToNextEvent(void) const
+    {
+        uint32_t ulUs = m_ulTickUs;
+
+        if (!m_bRefreshDue)
+        {
+            uint32_t ulTicks = m_TimingWheel.GetTicksToNextExpiry();
+
+            ulUs = (ulTicks == TimingWheel::NO_EXPIRY) ? TimingWheel::NO_EXPIRY :
+                                                         (ulTicks * m_ulTickUs) - m_ulResidualUs;
+        }
+
+        return ulUs;
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// KickScheduler::OnRefreshDue
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void KickScheduler::OnRefreshDue(void * pContext)
+    {
+        // The refresh itself is issued by Tick once the wheel is up to date, so that it is timed from the real time
+        // of the call rather than from a tick part way through a late Advance
+        static_cast<KickScheduler *>(pContext)->m_bRefreshDue = true;
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file KickScheduler.hpp
+///
+/// Description Window aware independent watchdog refresh scheduler
+///
+/// @par Full Description
+/// Class header for the KickScheduler class, which decides when the independent watchdog is refreshed so that the
+/// refresh always lands inside the OFS0 refresh window.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Refreshes are recorded in the WatchdogTrace
+/// - agent 16-Oct-2026 Added CancelKick
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __KICK_SCHEDULER_HPP__
+#define __KICK_SCHEDULER_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "TimingWheel.hpp"
+#include "WatchdogWindow.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// KickScheduler: KickScheduler
+///
+/// Issues one in-window watchdog refresh per watchdog timer cycle
+///
+/// @par Full Description
+/// With a refresh window configured, a refresh outside the window resets the MCU as surely as no refresh at all, so
+/// the application loops cannot simply call Watchdog::KickWatchdog whenever they are healthy.  Instead they call
+/// RequestKick, which only sets a flag and may be called any number of times from any thread.  Tick is called
+/// periodically from one timer context and owns the hardware: at the midpoint of each refresh window it refreshes
+/// the watchdog once if a kick was requested during the cycle.  Redundant requests are coalesced into that single
+/// refresh.
+///
+/// If no kick has been requested by the midpoint, the scheduler keeps checking on every Tick until one tick before
+/// the window closes and refreshes as soon as a request arrives.  After that it gives up on the cycle and the
+/// watchdog is left to reset the MCU, exactly as it would for a hung application.
+///
+/// The refresh deadline is kept in a hierarchical TimingWheel that other periodic deadlines may share through
+/// GetTimingWheel, and GetUsToNextEvent reports how long the timer context may sleep.
+///
+/// A refresh can be late by up to the time between Tick calls, so that period must be well below half the width
+/// of the refresh window.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class KickScheduler
+{
+    public:
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: KickScheduler::KickScheduler
+        ///
+        /// @par Full Description
+        /// Constructor
+        ///
+        /// @param  [in]  rWindow   Watchdog timeout and refresh window programmed in OFS0.
+        /// @param  [in]  ulTickUs  Resolution of the scheduler in microseconds, normally the period Tick is called at.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        KickScheduler(const WatchdogWindow & rWindow, uint32_t ulTickUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: KickScheduler::~KickScheduler
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~KickScheduler() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::Start
+        ///
+        /// @par Full Description
+        /// Starts scheduling from the beginning of a watchdog timer cycle.
+        ///
+        /// @pre    Called from the timer context at the start of a watchdog timer cycle, right after reset or a
+        ///         refresh.
+        /// @post   First refresh scheduled for the window midpoint.
+        ///
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Start(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::RequestKick
+        ///
+        /// @par Full Description
+        /// Asks for the watchdog to be refreshed in the current cycle.  One atomic store, callable from any thread or
+        /// interrupt.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void RequestKick(void)
+        {
+            m_bKickRequested.store(true, std::memory_order_relaxed);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::CancelKick
+        ///
+        /// @par Full Description
+        /// Withdraws the kick requested in the current cycle, for a requester that has since found the application
+        /// unhealthy, such as WatchdogSupervisor.  Requests made by other callers before it are withdrawn too.  One
+        /// atomic store.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CancelKick(void)
+        {
+            m_bKickRequested.store(false, std::memory_order_relaxed);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::Tick
+        ///
+        /// @par Full Description
+        /// Advances the timing wheel to the current time and refreshes the watchdog when a refresh is due and has
+        /// been requested.  The refresh is recorded in the WatchdogTrace under TRACE_CALLER_SCHEDULER.
+        ///
+        /// @pre    Start has been called.  Called from the timer context.
+        /// @post   Watchdog refreshed when due.
+        ///
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return whether the watchdog was refreshed
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Tick(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::GetUsToNextEvent
+        ///
+        /// @return microseconds until Tick next has work to do, a lower bound for sleeping the timer context
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetUsToNextEvent(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::GetTimingWheel
+        ///
+        /// @return the timing wheel driven by Tick, on which other deadlines in the timer context can be scheduled
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TimingWheel & GetTimingWheel(void) { return m_TimingWheel; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::GetRefreshCount
+        ///
+        /// @return refreshes issued since construction
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetRefreshCount(void) const { return m_ulRefreshCount; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: KickScheduler::GetMissedCount
+        ///
+        /// @return cycles whose refresh window closed without a kick being requested
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetMissedCount(void) const { return m_ulMissedCount; }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: KickScheduler::OnRefreshDue
+        ///
+        /// Timing wheel callback at the window midpoint.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void OnRefreshDue(void * pContext);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Kick requested by the application since the last refresh
+        std::atomic<bool> m_bKickRequested;
+
+        // Deadlines of the timer context
+        TimingWheel       m_TimingWheel;
+
+        // Expires at the window midpoint
+        TimingWheelTimer  m_RefreshTimer;
+
+        // Programmed watchdog timeout and window
+        WatchdogWindow    m_Window;
+
+        // Scheduler resolution in microseconds
+        uint32_t          m_ulTickUs;
+
+        // Ticks from the start of a cycle to the window midpoint
+        uint32_t          m_ulMidpointTicks;
+
+        // Start of the current watchdog timer cycle
+        uint32_t          m_ulCycleStartUs;
+
+        // Time of the last Tick and the part of a wheel tick elapsed since
+        uint32_t          m_ulLastTickUs;
+        uint32_t          m_ulResidualUs;
+
+        // Midpoint passed and no refresh issued yet in this cycle
+        bool              m_bRefreshDue;
+
+        uint32_t          m_ulRefreshCount;
+        uint32_t          m_ulMissedCount;
+
+        // Inhibit copy constructor and assignment operator
+        KickScheduler(KickScheduler &);
+
+        KickScheduler & operator=(KickScheduler const&); // assign op. hidden
+};
+} //CpfBsp;
+
+
+#endif //__KICK_SCHEDULER_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,439 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file LatencyHistogram.hpp
+///
+/// Description Fixed memory log-linear latency histogram
+///
+/// @par Full Description
+/// Class header and implementation of the LatencyHistogram and LatencyHistogramSnapshot class templates.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Per context counts in place of the shared atomic counts
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __LATENCY_HISTOGRAM_HPP__
+#define __LATENCY_HISTOGRAM_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyHistogramSnapshot: LatencyHistogramSnapshot
+///
+/// Bucket layout of a log-linear histogram and a plain copy of its counts
+///
+/// @par Full Description
+/// Values below 2^SIGNIFICANT_BITS each have their own bucket.  Above that every power of two range is split into
+/// 2^(SIGNIFICANT_BITS - 1) equal buckets, so a value is resolved to within 1 part in 2^(SIGNIFICANT_BITS - 1) of
+/// itself over the whole 32 bit range in a fixed BUCKET_COUNT counters.  This is the bucketing of HdrHistogram.
+///
+/// The snapshot is filled in by LatencyHistogram::TakeSnapshot and can then be examined at leisure.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS>
+class LatencyHistogramSnapshot
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        static_assert((SIGNIFICANT_BITS >= 1u) && (SIGNIFICANT_BITS <= 16u), "SIGNIFICANT_BITS out of range");
+
+        // Buckets per power of two range above the linear range
+        static const uint32_t HALF_BUCKET_SHIFT = SIGNIFICANT_BITS - 1u;
+
+        // Total buckets covering 0 to 2^32 - 1
+        static const uint32_t BUCKET_COUNT = (34u - SIGNIFICANT_BITS) << HALF_BUCKET_SHIFT;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetBucketIndex
+        ///
+        /// @par Full Description
+        /// Branch free: the shift is the number of bits of the value beyond the significant bits, and the shifted
+        /// value lands in the upper half of the sub buckets of its range.
+        ///
+        /// @param  [in]  ulValue   Value to bucket.
+        ///
+        /// @return index of the bucket holding ulValue
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint32_t GetBucketIndex(uint32_t ulValue)
+        {
+            uint32_t ulShift = static_cast<uint32_t>(31 - __builtin_clz(ulValue | LINEAR_MASK)) - HALF_BUCKET_SHIFT;
+
+            return (ulShift << HALF_BUCKET_SHIFT) + (ulValue >> ulShift);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetBucketLowest
+        ///
+        /// @param  [in]  ulIndex   Bucket index, less than BUCKET_COUNT.
+        ///
+        /// @return lowest value counted in the bucket
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint32_t GetBucketLowest(uint32_t ulIndex)
+        {
+            uint32_t ulRange = ulIndex >> HALF_BUCKET_SHIFT;
+            uint32_t ulShift = (ulRange > 1u) ? (ulRange - 1u) : 0u;
+
+            return (ulIndex - (ulShift << HALF_BUCKET_SHIFT)) << ulShift;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetBucketHighest
+        ///
+        /// @param  [in]  ulIndex   Bucket index, less than BUCKET_COUNT.
+        ///
+        /// @return highest value counted in the bucket
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint32_t GetBucketHighest(uint32_t ulIndex)
+        {
+            uint32_t ulRange = ulIndex >> HALF_BUCKET_SHIFT;
+            uint32_t ulShift = (ulRange > 1u) ? (ulRange - 1u) : 0u;
+
+            return GetBucketLowest(ulIndex) + ((1u << ulShift) - 1u);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetCount
+        ///
+        /// @param  [in]  ulIndex   Bucket index, less than BUCKET_COUNT.
+        ///
+        /// @return values counted in the bucket
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetCount(uint32_t ulIndex) const { return m_aulCounts[ulIndex]; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetTotalCount
+        ///
+        /// @return values counted in all buckets
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetTotalCount(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetValueAtPercentile
+        ///
+        /// @param  [in]  fPercentile   Percentile from 0 to 100.
+        ///
+        /// @return highest value of the bucket holding the percentile, 0 when the snapshot is empty
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetValueAtPercentile(float fPercentile) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetMinValue
+        ///
+        /// @return lowest value of the lowest occupied bucket, 0 when the snapshot is empty
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetMinValue(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogramSnapshot::GetMaxValue
+        ///
+        /// @return highest value of the highest occupied bucket, 0 when the snapshot is empty
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetMaxValue(void) const { return GetValueAtPercentile(100.0F); }
+
+    private:
+
+        template <uint32_t, uint32_t> friend class LatencyHistogram;
+
+        // Values below this each have their own bucket
+        static const uint32_t LINEAR_MASK = (1u << SIGNIFICANT_BITS) - 1u;
+
+        // Count of each bucket
+        uint32_t m_aulCounts[BUCKET_COUNT];
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// LatencyHistogram: LatencyHistogram
+///
+/// Wait-free log-linear histogram of 32 bit values such as latencies in microseconds
+///
+/// @par Full Description
+/// Recording a value is one count leading zeros, a shift, and a load and store of the bucket's count, with no locks
+/// and no allocation, so it can be done on a time critical path.  Each recording context, a thread or an interrupt,
+/// has its own set of CONTEXT_COUNT counts and is the only writer of it, so no read-modify-write is needed, see
+/// SampleRing for why that matters on the Cortex-M0+.  The memory is fixed at CONTEXT_COUNT + 1 sets of
+/// BUCKET_COUNT 32 bit counters; see LatencyHistogramSnapshot for the bucketing.
+///
+/// TakeSnapshot adds up the contexts' counts for analysis.  The recorders' counts are never cleared, since a clear
+/// could cross an increment, so Reset and TakeSnapshotAndReset keep the merged counts at the reset and snapshots
+/// count from there.  Successive TakeSnapshotAndReset snapshots partition the recorded values with none lost or
+/// counted twice.  The snapshots and resets are taken from one reader context.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS, uint32_t CONTEXT_COUNT = 1u>
+class LatencyHistogram
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        typedef LatencyHistogramSnapshot<SIGNIFICANT_BITS> Snapshot;
+
+        static const uint32_t BUCKET_COUNT = Snapshot::BUCKET_COUNT;
+
+        static_assert(CONTEXT_COUNT > 0u, "A histogram needs at least one recording context");
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LatencyHistogram::LatencyHistogram
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        LatencyHistogram();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LatencyHistogram::~LatencyHistogram
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~LatencyHistogram() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogram::Record
+        ///
+        /// @pre    Only one thread or interrupt records to each context.
+        ///
+        /// @param  [in]  ulValue     Value to count.
+        /// @param  [in]  ulContext   Recording context, less than CONTEXT_COUNT.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Record(uint32_t ulValue, uint32_t ulContext = 0u)
+        {
+            std::atomic<uint32_t> & rCount = m_aulCounts[ulContext][Snapshot::GetBucketIndex(ulValue)];
+
+            // The context is the only writer of its counts
+            rCount.store(rCount.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogram::TakeSnapshot
+        ///
+        /// @param  [out] rSnapshot Receives the counts since the last reset.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void TakeSnapshot(Snapshot & rSnapshot) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogram::TakeSnapshotAndReset
+        ///
+        /// @param  [out] rSnapshot Receives the counts since the last reset, which is then moved to now.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void TakeSnapshotAndReset(Snapshot & rSnapshot);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogram::Reset
+        ///
+        /// @par Full Description
+        /// Counts from now on, the values recorded so far are left out of later snapshots.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+    private:
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: LatencyHistogram::GetMergedCount
+        ///
+        /// @param  [in]  ulIndex   Bucket index, less than BUCKET_COUNT.
+        ///
+        /// @return count of a bucket added up over the contexts, modulo 2^32
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetMergedCount(uint32_t ulIndex) const
+        {
+            uint32_t ulCount = 0;
+
+            for (uint32_t ulContext = 0; ulContext < CONTEXT_COUNT; ++ulContext)
+            {
+                ulCount += m_aulCounts[ulContext][ulIndex].load(std::memory_order_relaxed);
+            }
+
+            return ulCount;
+        }
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Count of each bucket in each context, free running and written by that context only
+        std::atomic<uint32_t> m_aulCounts[CONTEXT_COUNT][BUCKET_COUNT];
+
+        // Merged count of each bucket at the last reset, written by the reader only
+        uint32_t              m_aulResetCounts[BUCKET_COUNT];
+
+        // Inhibit copy constructor and assignment operator
+        LatencyHistogram(LatencyHistogram &);
+
+        LatencyHistogram & operator=(LatencyHistogram const&); // assign op. hidden
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogramSnapshot::GetTotalCount
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS>
+uint32_t LatencyHistogramSnapshot<SIGNIFICANT_BITS>::GetTotalCount(void) const
+{
+    uint32_t ulTotal = 0;
+
+    for (uint32_t ulIndex = 0; ulIndex < BUCKET_COUNT; ++ulIndex)
+    {
+        ulTotal += m_aulCounts[ulIndex];
+    }
+
+    return ulTotal;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogramSnapshot::GetValueAtPercentile
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS>
+uint32_t LatencyHistogramSnapshot<SIGNIFICANT_BITS>::GetValueAtPercentile(float fPercentile) const
+{
+    uint32_t ulTotal = GetTotalCount();
+    uint32_t ulValue = 0;
+
+    if (ulTotal != 0u)
+    {
+        // Rank of the value at the percentile, at least the first value
+        double dRank = (static_cast<double>(ulTotal) * static_cast<double>(fPercentile)) / 100.0;
+        uint32_t ulRank = static_cast<uint32_t>(dRank);
+
+        ulRank += ((static_cast<double>(ulRank) < dRank) || (ulRank == 0u)) ? 1u : 0u;
+        ulRank = (ulRank < ulTotal) ? ulRank : ulTotal;
+
+        uint32_t ulCumulative = 0;
+        uint32_t ulIndex = 0;
+
+        for (; ulIndex < BUCKET_COUNT; ++ulIndex)
+        {
+            ulCumulative += m_aulCounts[ulIndex];
+
+            if (ulCumulative >= ulRank)
+            {
+                break;
+            }
+        }
+
+        ulValue = GetBucketHighest(ulIndex);
+    }
+
+    return ulValue;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogramSnapshot::GetMinValue
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS>
+uint32_t LatencyHistogramSnapshot<SIGNIFICANT_BITS>::GetMinValue(void) const
+{
+    uint32_t ulIndex = 0;
+
+    while ((ulIndex < BUCKET_COUNT) && (m_aulCounts[ulIndex] == 0u))
+    {
+        ++ulIndex;
+    }
+
+    return (ulIndex < BUCKET_COUNT) ? GetBucketLowest(ulIndex) : 0u;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogram::LatencyHistogram
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS, uint32_t CONTEXT_COUNT>
+LatencyHistogram<SIGNIFICANT_BITS, CONTEXT_COUNT>::LatencyHistogram()
+{
+    for (uint32_t ulIndex = 0; ulIndex < BUCKET_COUNT; ++ulIndex)
+    {
+        for (uint32_t ulContext = 0; ulContext < CONTEXT_COUNT; ++ulContext)
+        {
+            m_aulCounts[ulContext][ulIndex].store(0u, std::memory_order_relaxed);
+        }
+
+        m_aulResetCounts[ulIndex] = 0u;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogram::TakeSnapshot
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS, uint32_t CONTEXT_COUNT>
+void LatencyHistogram<SIGNIFICANT_BITS, CONTEXT_COUNT>::TakeSnapshot(Snapshot & rSnapshot) const
+{
+    // Modulo 2^32 subtraction handles counts that have wrapped since the reset
+    for (uint32_t ulIndex = 0; ulIndex < BUCKET_COUNT; ++ulIndex)
+    {
+        rSnapshot.m_aulCounts[ulIndex] = GetMergedCount(ulIndex) - m_aulResetCounts[ulIndex];
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogram::TakeSnapshotAndReset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS, uint32_t CONTEXT_COUNT>
+void LatencyHistogram<SIGNIFICANT_BITS, CONTEXT_COUNT>::TakeSnapshotAndReset(Snapshot & rSnapshot)
+{
+    // Each merged count is read once, so a value recorded meanwhile is in this snapshot or the next
+    for (uint32_t ulIndex = 0; ulIndex < BUCKET_COUNT; ++ulIndex)
+    {
+        uint32_t ulCount = GetMergedCount(ulIndex);
+
+        rSnapshot.m_aulCounts[ulIndex] = ulCount - m_aulResetCounts[ulIndex];
+        m_aulResetCounts[ulIndex] = ulCount;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LatencyHistogram::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t SIGNIFICANT_BITS, uint32_t CONTEXT_COUNT>
+void LatencyHistogram<SIGNIFICANT_BITS, CONTEXT_COUNT>::Reset(void)
+{
+    for (uint32_t ulIndex = 0; ulIndex < BUCKET_COUNT; ++ulIndex)
+    {
+        m_aulResetCounts[ulIndex] = GetMergedCount(ulIndex);
+    }
+}
+
+} //CpfBsp;
+
+
+#endif //__LATENCY_HISTOGRAM_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
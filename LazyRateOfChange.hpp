@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file LazyRateOfChange.hpp
+///
+/// For rates of change calculated when read rather than when sampled
+///
+/// @par Full Description
+/// Class header and implementation of the LazyRateOfChange class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(LAZY_RATE_OF_CHANGE_HPP)
+#define LAZY_RATE_OF_CHANGE_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FloatLib.hpp"
+#include "RateOfChange.hpp"
+#include "TimeBase.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: LazyRateOfChange
+    ///
+    /// For channels sampled every scan whose rate of change is only read occasionally
+    ///
+    /// @par Full Description
+    /// Record keeps the latest two samples in a two slot ring indexed by a free running sample count, so the scan
+    /// pays one sample store and one increment and no division.  GetRate calculates the rate between the two
+    /// samples on demand and caches it against the sample count, so repeated reads between samples cost a compare.
+    ///
+    /// The rate is the one BasicRateOfChange::CalcRateOfChange would have returned for the latest sample, bit for
+    /// bit: 0 until two samples have been recorded, App::FLOAT_INFINITY when the two timestamps are equal, and the
+    /// modulo difference of the timestamps across a counter overflow.  The output unit is fixed per channel by the
+    /// RateUnit parameter, so the scaling stays a compile time constant.
+    ///
+    /// Like RateOfChange, a channel belongs to one task.  A reader in another task, such as an HMI server, reads it
+    /// through whatever already hands the task's data across.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename RateUnit, typename TimeBase = TimeBaseUs32>
+class LazyRateOfChange
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Timestamp type of the time base
+        typedef typename TimeBase::Tick Tick;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LazyRateOfChange::LazyRateOfChange
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        LazyRateOfChange() : m_ulSampleCount(0), m_ulCachedCount(0), m_fCachedRate(0.0f) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LazyRateOfChange::~LazyRateOfChange
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~LazyRateOfChange() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LazyRateOfChange::Record
+        ///
+        /// Record a sample, replacing the older of the two held.
+        ///
+        /// @param  [in]  fCurrentValue       Current value.
+        /// @param  [in]  tCurrentTimestamp   Current timestamp in time base ticks.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Record(float fCurrentValue, Tick tCurrentTimestamp)
+        {
+            Sample & rSample = m_aSamples[m_ulSampleCount & 1u];
+
+            rSample.fValue = fCurrentValue;
+            rSample.tTimestamp = tCurrentTimestamp;
+
+            // Skips 0 and 1 on overflow, which would read as fewer than two samples, keeping the slot parity
+            m_ulSampleCount = (m_ulSampleCount != UINT32_MAX) ? (m_ulSampleCount + 1u) : 2u;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LazyRateOfChange::GetRate
+        ///
+        /// @return rate of change between the latest two samples in units per RateUnit
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float GetRate(void)
+        {
+            if (m_ulCachedCount != m_ulSampleCount)
+            {
+                m_fCachedRate = CalcRate();
+                m_ulCachedCount = m_ulSampleCount;
+            }
+
+            return m_fCachedRate;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LazyRateOfChange::Reset
+        ///
+        /// Forget the samples, the rate is 0 until two more are recorded.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void)
+        {
+            m_ulSampleCount = 0;
+            m_ulCachedCount = 0;
+            m_fCachedRate = 0.0f;
+        }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // One recorded sample
+        struct Sample
+        {
+            float fValue;
+            Tick  tTimestamp;
+        };
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LazyRateOfChange::CalcRate
+        ///
+        /// @return rate of change between the latest two samples, as BasicRateOfChange::CalcRateOfChange does it
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float CalcRate(void) const;
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Latest two samples, the newest in slot (m_ulSampleCount - 1) & 1
+        Sample   m_aSamples[2];
+
+        // Samples recorded since reset, free running
+        uint32_t m_ulSampleCount;
+
+        // Sample count m_fCachedRate was calculated at, it is stale when the count has moved on
+        uint32_t m_ulCachedCount;
+
+        // Last rate calculated
+        float    m_fCachedRate;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LazyRateOfChange::CalcRate
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename RateUnit, typename TimeBase>
+float LazyRateOfChange<RateUnit, TimeBase>::CalcRate(void) const
+{
+    // Same constant as BasicRateOfChange, so the rates match it bit for bit
+    constexpr float UNITS_PER_TICK = static_cast<float>(static_cast<double>(RateUnit::UNITS_PER_SECOND) /
+                                                        static_cast<double>(TimeBase::TICKS_PER_SECOND));
+
+    float fRateOfChange = 0.0f;
+
+    if (m_ulSampleCount >= 2u)
+    {
+        const Sample & rCurrent = m_aSamples[(m_ulSampleCount - 1u) & 1u];
+        const Sample & rPrevious = m_aSamples[m_ulSampleCount & 1u];
+
+        Tick tDifference = TimeBase::Elapsed(rCurrent.tTimestamp, rPrevious.tTimestamp);
+
+        fRateOfChange = App::FLOAT_INFINITY;
+
+        if (tDifference != 0)
+        {
+            fRateOfChange = (rCurrent.fValue - rPrevious.fValue) / (static_cast<float>(tDifference) * UNITS_PER_TICK);
+        }
+    }
+
+    return fRateOfChange;
+}
+
+} // SignalChain
+#endif // #if !defined(LAZY_RATE_OF_CHANGE_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file LeastSquaresSlope.hpp
+///
+/// For estimating rates of change by a sliding window least squares fit
+///
+/// @par Full Description
+/// Class header and implementation of the LeastSquaresSlope class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 The origin moves by shifting the sums in O(1) instead of recomputing them from the history
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(LEAST_SQUARES_SLOPE_HPP)
+#define LEAST_SQUARES_SLOPE_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FloatLib.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: LeastSquaresSlope
+    ///
+    /// For estimating the rate of change over the last WINDOW_SIZE samples
+    ///
+    /// @par Full Description
+    /// Returns the slope of the least squares line through the last WINDOW_SIZE samples, which is far less noisy
+    /// than the two point difference of RateOfChange.  Timestamps do not have to be evenly spaced.
+    ///
+    /// The fit is kept as running sums of t, v, t*t and t*v, so adding a sample and dropping the oldest one costs the
+    /// same regardless of the window size.  Times and values are held relative to an origin sample so the sums stay
+    /// the size of the window rather than of the timestamps, and once per window length the origin moves to the
+    /// oldest sample.  The sums are shifted to the new origin algebraically, which costs the same as adding a
+    /// sample, so every sample is O(1) with no periodic pass over the history to stall the scan.  The sums are double
+    /// precision because the t*t terms lose too much in single precision.
+    ///
+    /// The origin is up to a window behind the oldest sample, so times are measured across up to two windows: any
+    /// 2 * WINDOW_SIZE - 1 consecutive samples must span less than 2^31 microseconds.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t WINDOW_SIZE>
+class LeastSquaresSlope
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LeastSquaresSlope::LeastSquaresSlope
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        LeastSquaresSlope()
+        {
+            Reset();
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LeastSquaresSlope::~LeastSquaresSlope
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~LeastSquaresSlope() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LeastSquaresSlope::CalcSlopeUs
+        ///
+        /// Add a sample to the window and calculate the slope in units per microsecond.
+        ///
+        /// @par Full Description
+        /// The current sample replaces the oldest one once the window is full.  Fewer than two samples give a slope
+        /// of 0, the same as the initial call of RateOfChange.  When every sample in the window has the same
+        /// timestamp the slope is undefined and App::FLOAT_INFINITY is returned.
+        ///
+        /// @pre    none.
+        /// @post   Sample added to the window and the slope calculated.
+        ///
+        /// @param  [in]  fCurrentValue          Current value.
+        /// @param  [in]  ulCurrentTimestampUs   Current timestamp in microseconds.
+        ///
+        /// @return Least squares slope in units per microsecond
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float CalcSlopeUs(float fCurrentValue, uint32_t ulCurrentTimestampUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LeastSquaresSlope::Reset
+        ///
+        /// Empty the window.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LeastSquaresSlope::GetSampleCount
+        ///
+        /// @return Number of samples currently in the window
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetSampleCount(void) const { return m_ulCount; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        static_assert(WINDOW_SIZE >= 2, "A slope needs a window of at least two samples");
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LeastSquaresSlope::Recenter
+        ///
+        /// Move the origin to the oldest sample and shift the running sums to it.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Recenter(void);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Value history, oldest sample at m_ulOldest
+        float    m_afValues[WINDOW_SIZE];
+
+        // Timestamp history in microseconds
+        uint32_t m_aulTimestampsUs[WINDOW_SIZE];
+
+        // Index of the oldest sample
+        uint32_t m_ulOldest;
+
+        // Number of samples in the window
+        uint32_t m_ulCount;
+
+        // Samples added since the origin last moved
+        uint32_t m_ulSamplesSinceRecenter;
+
+        // Origin the sums are relative to
+        uint32_t m_ulOriginTimestampUs;
+        float    m_fOriginValue;
+
+        // Running sums of the relative times and values
+        double   m_dSumT;
+        double   m_dSumV;
+        double   m_dSumTT;
+        double   m_dSumTV;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LeastSquaresSlope::CalcSlopeUs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t WINDOW_SIZE>
+float LeastSquaresSlope<WINDOW_SIZE>::CalcSlopeUs(float fCurrentValue, uint32_t ulCurrentTimestampUs)
+{
+    float fSlope = 0.0f;
+
+    if (m_ulCount == 0)
+    {
+        m_ulOriginTimestampUs = ulCurrentTimestampUs;
+        m_fOriginValue = fCurrentValue;
+    }
+
+    //
+    // Drop the oldest sample from the sums when the window is full.  Its slot is the one the current sample goes in.
+    //
+    uint32_t ulSlot = m_ulOldest + m_ulCount;
+
+    if (m_ulCount == WINDOW_SIZE)
+    {
+        // Modulo 2^32 subtraction handles a timestamp overflow since the origin
+        double dT = static_cast<double>(static_cast<int32_t>(m_aulTimestampsUs[m_ulOldest] - m_ulOriginTimestampUs));
+        double dV = static_cast<double>(m_afValues[m_ulOldest]) - static_cast<double>(m_fOriginValue);
+
+        m_dSumT  -= dT;
+        m_dSumV  -= dV;
+        m_dSumTT -= dT * dT;
+        m_dSumTV -= dT * dV;
+
+        ulSlot = m_ulOldest;
+        m_ulOldest = (m_ulOldest + 1 == WINDOW_SIZE) ? 0 : (m_ulOldest + 1);
+    }
+    else
+    {
+        ++m_ulCount;
+    }
+
+    if (ulSlot >= WINDOW_SIZE)
+    {
+        ulSlot -= WINDOW_SIZE;
+    }
+
+    m_afValues[ulSlot] = fCurrentValue;
+    m_aulTimestampsUs[ulSlot] = ulCurrentTimestampUs;
+
+    double dT = static_cast<double>(static_cast<int32_t>(ulCurrentTimestampUs - m_ulOriginTimestampUs));
+    double dV = static_cast<double>(fCurrentValue) - static_cast<double>(m_fOriginValue);
+
+    m_dSumT  += dT;
+    m_dSumV  += dV;
+    m_dSumTT += dT * dT;
+    m_dSumTV += dT * dV;
+
+    if (++m_ulSamplesSinceRecenter >= WINDOW_SIZE)
+    {
+        Recenter();
+    }
+
+    if (m_ulCount >= 2)
+    {
+        double dCount = static_cast<double>(m_ulCount);
+
+        // Centered second moments of the window
+        double dSumSquaresT = m_dSumTT - ((m_dSumT * m_dSumT) / dCount);
+        double dSumProductsTV = m_dSumTV - ((m_dSumT * m_dSumV) / dCount);
+
+        // Init to INFINITY in case every timestamp in the window is equal which would result in a divide by Zero
+        fSlope = App::FLOAT_INFINITY;
+
+        if (dSumSquaresT > 0.0)
+        {
+            fSlope = static_cast<float>(dSumProductsTV / dSumSquaresT);
+        }
+    }
+
+    return fSlope;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LeastSquaresSlope::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t WINDOW_SIZE>
+void LeastSquaresSlope<WINDOW_SIZE>::Reset(void)
+{
+    m_ulOldest = 0;
+    m_ulCount = 0;
+    m_ulSamplesSinceRecenter = 0;
+    m_ulOriginTimestampUs = 0;
+    m_fOriginValue = 0.0f;
+    m_dSumT = 0.0;
+    m_dSumV = 0.0;
+    m_dSumTT = 0.0;
+    m_dSumTV = 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// LeastSquaresSlope::Recenter
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t WINDOW_SIZE>
+void LeastSquaresSlope<WINDOW_SIZE>::Recenter(void)
+{
+    // Shift of the origin, the oldest sample relative to the current origin
+    double dShiftT = static_cast<double>(static_cast<int32_t>(m_aulTimestampsUs[m_ulOldest] - m_ulOriginTimestampUs));
+    double dShiftV = static_cast<double>(m_afValues[m_ulOldest]) - static_cast<double>(m_fOriginValue);
+    double dCount = static_cast<double>(m_ulCount);
+
+    //
+    // With t' = t - dShiftT and v' = v - dShiftV over the n samples of the window:
+    //   sum t'   = sum t - n dShiftT
+    //   sum v'   = sum v - n dShiftV
+    //   sum t't' = sum tt - 2 dShiftT sum t + n dShiftT^2
+    //   sum t'v' = sum tv - dShiftT sum v - dShiftV sum t + n dShiftT dShiftV
+    // The products use the sums before the shift.
+    //
+    m_dSumTT += (dShiftT * ((dCount * dShiftT) - (2.0 * m_dSumT)));
+    m_dSumTV += ((dCount * dShiftT * dShiftV) - (dShiftT * m_dSumV) - (dShiftV * m_dSumT));
+    m_dSumT  -= dCount * dShiftT;
+    m_dSumV  -= dCount * dShiftV;
+
+    m_ulOriginTimestampUs = m_aulTimestampsUs[m_ulOldest];
+    m_fOriginValue = m_afValues[m_ulOldest];
+
+    m_ulSamplesSinceRecenter = 0;
+}
+
+} // SignalChain
+#endif // #if !defined(LEAST_SQUARES_SLOPE_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,421 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file MultiHorizonRateOfChange.hpp
+///
+/// For calculating rates of change over several time horizons at once
+///
+/// @par Full Description
+/// Class header and implementation of the MultiHorizonRateOfChange class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Each horizon keeps a cursor on its sample instead of searching the levels every update
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(MULTI_HORIZON_RATE_OF_CHANGE_HPP)
+#define MULTI_HORIZON_RATE_OF_CHANGE_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FloatLib.hpp"
+#include "RateOfChange.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: MultiHorizonRateOfChange
+    ///
+    /// For calculating the rate of change of one signal over HORIZON_COUNT horizons from a single update
+    ///
+    /// @par Full Description
+    /// The rate over a horizon H is the change from the newest sample at least H old to the current sample, divided
+    /// by the time actually between them.
+    ///
+    /// History is kept in LEVEL_COUNT rings of LEVEL_SIZE samples.  Level 0 holds every sample, level 1 every second
+    /// sample, level k every 2^k th sample, so together the levels reach back LEVEL_SIZE << (LEVEL_COUNT - 1) samples
+    /// in LEVEL_SIZE * LEVEL_COUNT slots.  An update stores the sample in level 0 and in each level it is due in,
+    /// which is two stores per sample on average, and each horizon is then answered from the finest level reaching
+    /// back far enough.  Each horizon keeps a cursor on the level and sample it was last answered from.  Samples
+    /// only grow older, so the cursor stays in its level and moves forward over the samples that have since become
+    /// old enough, which is amortized one comparison per horizon per sample.  Only when the cursor changes level or
+    /// its sample drops out of the level, after reset or a change in the sample rate, is the level searched again,
+    /// by a binary search of at most log2(LEVEL_SIZE) steps.  The memory is independent of the horizons.
+    ///
+    /// The span a rate is taken over can exceed H by up to one sample spacing of the level used: less than a sample
+    /// period in level 0, and less than 2 / LEVEL_SIZE of H in the coarser levels.  The rate itself is exact for the
+    /// span it is taken over.  A horizon no longer than the sample period gives the rate between successive
+    /// samples, bit-identical to RateOfChange, except that samples at the current timestamp are passed over so equal
+    /// timestamps never give infinity.
+    ///
+    /// A horizon the history does not reach back to yet, after construction or reset, gives 0, as the initial call
+    /// of RateOfChange does.  A horizon beyond what the levels can hold at the sample rate in use always gives 0.
+    ///
+    /// Timestamps are 32 bit microseconds and are extended to 64 bits internally, so the history may span any number
+    /// of counter overflows as long as successive samples are less than 2^32 microseconds apart.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t HORIZON_COUNT, uint32_t LEVEL_SIZE = 64, uint32_t LEVEL_COUNT = 16>
+class MultiHorizonRateOfChange
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::MultiHorizonRateOfChange
+        ///
+        /// Constructor
+        ///
+        /// @param  [in]  aulHorizonsUs   Horizon of each rate in microseconds, a horizon of 0 is taken as 1.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit MultiHorizonRateOfChange(const uint32_t (&aulHorizonsUs)[HORIZON_COUNT]);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::~MultiHorizonRateOfChange
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MultiHorizonRateOfChange() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::CalcRates
+        ///
+        /// Add a sample and calculate the rate of change over every horizon in units per RateUnit.
+        ///
+        /// @pre    pfRates holds HORIZON_COUNT elements.
+        /// @post   Sample added to the history and the rates calculated.
+        ///
+        /// @param  [in]  fCurrentValue          Current value.
+        /// @param  [in]  ulCurrentTimestampUs   Current timestamp in microseconds.
+        /// @param  [out] pfRates                Rate of change over each horizon, in the order of the horizons.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename RateUnit>
+        void CalcRates(float fCurrentValue, uint32_t ulCurrentTimestampUs, float * pfRates);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::CalcRatesUs
+        ///
+        /// CalcRates in units per microsecond.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CalcRatesUs(float fCurrentValue, uint32_t ulCurrentTimestampUs, float * pfRates)
+        {
+            CalcRates<RateUnitUs>(fCurrentValue, ulCurrentTimestampUs, pfRates);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::CalcRatesSec
+        ///
+        /// CalcRates in units per second.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CalcRatesSec(float fCurrentValue, uint32_t ulCurrentTimestampUs, float * pfRates)
+        {
+            CalcRates<RateUnitSec>(fCurrentValue, ulCurrentTimestampUs, pfRates);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::Reset
+        ///
+        /// Empty the history.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::GetHorizonUs
+        ///
+        /// @return horizon ulHorizon in microseconds
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetHorizonUs(uint32_t ulHorizon) const { return m_aulHorizonsUs[ulHorizon]; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        static_assert(HORIZON_COUNT != 0, "At least one horizon is needed");
+        static_assert((LEVEL_SIZE >= 4) && ((LEVEL_SIZE & (LEVEL_SIZE - 1)) == 0),
+                      "Level size must be a power of two of at least 4");
+        static_assert((LEVEL_COUNT != 0) && (LEVEL_COUNT <= 32), "Levels are decimated by up to 2^31");
+
+        // Mask from a free running index to a slot
+        static const uint32_t SLOT_MASK = LEVEL_SIZE - 1;
+
+        // History of one decimation level.  Samples are indexed by a free running count, the slot of index i is
+        // i & SLOT_MASK and the level holds indexes ulCount - ulStored to ulCount - 1.
+        struct Level
+        {
+            float    afValues[LEVEL_SIZE];
+            uint64_t aullTimesUs[LEVEL_SIZE];
+            uint32_t ulCount;                   ///< Samples added since reset, free running
+            uint32_t ulStored;                  ///< Samples held, at most LEVEL_SIZE
+        };
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::GetAgeUs
+        ///
+        /// @return time from the sample with index ulIndex in a level to the current time
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint64_t GetAgeUs(const Level & rLevel, uint32_t ulIndex) const
+        {
+            return m_ullTimeUs - rLevel.aullTimesUs[ulIndex & SLOT_MASK];
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::ReachesBack
+        ///
+        /// @return whether the oldest sample of a level is at least ullHorizonUs old
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool ReachesBack(const Level & rLevel, uint64_t ullHorizonUs) const
+        {
+            return (rLevel.ulStored != 0) && (GetAgeUs(rLevel, rLevel.ulCount - rLevel.ulStored) >= ullHorizonUs);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: MultiHorizonRateOfChange::FindSample
+        ///
+        /// Find the newest sample at least the horizon ulHorizon before the current time and move its cursor there.
+        ///
+        /// @return whether the history reaches back that far, rulLevel and rulSlot locate the sample when it does
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool FindSample(uint32_t ulHorizon, uint32_t & rulLevel, uint32_t & rulSlot);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Horizons in microseconds
+        uint32_t m_aulHorizonsUs[HORIZON_COUNT];
+
+        // Decimated histories, level k holds every 2^k th sample
+        Level    m_aLevels[LEVEL_COUNT];
+
+        // Level and sample index each horizon was last answered from, a level of LEVEL_COUNT when it was not
+        uint32_t m_aulCursorLevels[HORIZON_COUNT];
+        uint32_t m_aulCursorIndexes[HORIZON_COUNT];
+
+        // Samples added since reset, free running, only ever used modulo the decimation factors
+        uint32_t m_ulSampleCount;
+
+        // No sample since reset
+        bool     m_bInitialCall;
+
+        // Previous timestamp and the current time extended to 64 bits
+        uint32_t m_ulPreviousTimestampUs;
+        uint64_t m_ullTimeUs;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MultiHorizonRateOfChange::MultiHorizonRateOfChange
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t HORIZON_COUNT, uint32_t LEVEL_SIZE, uint32_t LEVEL_COUNT>
+MultiHorizonRateOfChange<HORIZON_COUNT, LEVEL_SIZE, LEVEL_COUNT>::MultiHorizonRateOfChange(
+    const uint32_t (&aulHorizonsUs)[HORIZON_COUNT])
+{
+    for (uint32_t ulHorizon = 0; ulHorizon < HORIZON_COUNT; ++ulHorizon)
+    {
+        m_aulHorizonsUs[ulHorizon] = (aulHorizonsUs[ulHorizon] != 0) ? aulHorizonsUs[ulHorizon] : 1u;
+    }
+
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MultiHorizonRateOfChange::CalcRates
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t HORIZON_COUNT, uint32_t LEVEL_SIZE, uint32_t LEVEL_COUNT>
+template <typename RateUnit>
+void MultiHorizonRateOfChange<HORIZON_COUNT, LEVEL_SIZE, LEVEL_COUNT>::CalcRates(float      fCurrentValue,
+                                                                                 uint32_t   ulCurrentTimestampUs,
+                                                                                 float *    pfRates)
+{
+    // Same constant as BasicRateOfChange on TimeBaseUs32, so single sample rates match it bit for bit
+    constexpr float UNITS_PER_TICK = static_cast<float>(static_cast<double>(RateUnit::UNITS_PER_SECOND) /
+                                                        static_cast<double>(TimeBaseUs32::TICKS_PER_SECOND));
+
+    //
+    // Extend the timestamp to 64 bits.  The modulo difference of successive timestamps handles each overflow.
+    //
+    m_ullTimeUs = m_bInitialCall ? ulCurrentTimestampUs :
+                  (m_ullTimeUs + TimeBaseUs32::Elapsed(ulCurrentTimestampUs, m_ulPreviousTimestampUs));
+
+    m_ulPreviousTimestampUs = ulCurrentTimestampUs;
+    m_bInitialCall = false;
+
+    //
+    // Store the sample in level 0 and in every level it is due in.  Level k takes the samples whose index is a
+    // multiple of 2^k, so the loop stops at the first level the index is not a multiple for.
+    //
+    uint32_t ulLevel = 0;
+
+    do
+    {
+        Level & rLevel = m_aLevels[ulLevel];
+
+        rLevel.afValues[rLevel.ulCount & SLOT_MASK] = fCurrentValue;
+        rLevel.aullTimesUs[rLevel.ulCount & SLOT_MASK] = m_ullTimeUs;
+        ++rLevel.ulCount;
+        rLevel.ulStored += (rLevel.ulStored < LEVEL_SIZE) ? 1u : 0u;
+        ++ulLevel;
+    }
+    while ((ulLevel < LEVEL_COUNT) && ((m_ulSampleCount & ((1u << ulLevel) - 1u)) == 0));
+
+    ++m_ulSampleCount;
+
+    for (uint32_t ulHorizon = 0; ulHorizon < HORIZON_COUNT; ++ulHorizon)
+    {
+        uint32_t ulFoundLevel = 0;
+        uint32_t ulFoundSlot = 0;
+        float fRateOfChange = 0.0f;
+
+        if (FindSample(ulHorizon, ulFoundLevel, ulFoundSlot))
+        {
+            const Level & rLevel = m_aLevels[ulFoundLevel];
+
+            // At least the horizon, which is at least 1, so never zero
+            uint64_t ullElapsedUs = m_ullTimeUs - rLevel.aullTimesUs[ulFoundSlot];
+
+            fRateOfChange = (fCurrentValue - rLevel.afValues[ulFoundSlot]) /
+                            (static_cast<float>(ullElapsedUs) * UNITS_PER_TICK);
+        }
+
+        pfRates[ulHorizon] = fRateOfChange;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MultiHorizonRateOfChange::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t HORIZON_COUNT, uint32_t LEVEL_SIZE, uint32_t LEVEL_COUNT>
+void MultiHorizonRateOfChange<HORIZON_COUNT, LEVEL_SIZE, LEVEL_COUNT>::Reset(void)
+{
+    for (uint32_t ulLevel = 0; ulLevel < LEVEL_COUNT; ++ulLevel)
+    {
+        m_aLevels[ulLevel].ulCount = 0;
+        m_aLevels[ulLevel].ulStored = 0;
+    }
+
+    for (uint32_t ulHorizon = 0; ulHorizon < HORIZON_COUNT; ++ulHorizon)
+    {
+        m_aulCursorLevels[ulHorizon] = LEVEL_COUNT;
+        m_aulCursorIndexes[ulHorizon] = 0;
+    }
+
+    m_ulSampleCount = 0;
+    m_bInitialCall = true;
+    m_ulPreviousTimestampUs = 0;
+    m_ullTimeUs = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// MultiHorizonRateOfChange::FindSample
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t HORIZON_COUNT, uint32_t LEVEL_SIZE, uint32_t LEVEL_COUNT>
+bool MultiHorizonRateOfChange<HORIZON_COUNT, LEVEL_SIZE, LEVEL_COUNT>::FindSample(uint32_t   ulHorizon,
+                                                                                  uint32_t & rulLevel,
+                                                                                  uint32_t & rulSlot)
+{
+    const uint64_t ullHorizonUs = m_aulHorizonsUs[ulHorizon];
+    uint32_t ulLevel = m_aulCursorLevels[ulHorizon];
+    uint32_t ulIndex = m_aulCursorIndexes[ulHorizon];
+    bool bSearch = false;
+
+    //
+    // A coarser level always reaches back at least as far as a finer one, so the finest level reaching back far
+    // enough is found by stepping from the cursor's level, which normally is still the one.
+    //
+    while ((ulLevel > 0) && ReachesBack(m_aLevels[ulLevel - 1], ullHorizonUs))
+    {
+        --ulLevel;
+        bSearch = true;
+    }
+
+    while ((ulLevel < LEVEL_COUNT) && !ReachesBack(m_aLevels[ulLevel], ullHorizonUs))
+    {
+        ++ulLevel;
+        bSearch = true;
+    }
+
+    bool bFound = (ulLevel < LEVEL_COUNT);
+
+    if (bFound)
+    {
+        const Level & rLevel = m_aLevels[ulLevel];
+        uint32_t ulOldest = rLevel.ulCount - rLevel.ulStored;
+
+        if (bSearch || ((ulIndex - ulOldest) >= rLevel.ulStored))
+        {
+            //
+            // The cursor is in another level or its sample has been overwritten.  Ages fall with the index, so a
+            // binary search finds the youngest sample that is old enough: ulIndex always is and ulYoung never is.
+            //
+            uint32_t ulYoung = rLevel.ulCount;
+
+            ulIndex = ulOldest;
+
+            while ((ulYoung - ulIndex) > 1u)
+            {
+                uint32_t ulMiddle = ulIndex + ((ulYoung - ulIndex) / 2u);
+
+                if (GetAgeUs(rLevel, ulMiddle) >= ullHorizonUs)
+                {
+                    ulIndex = ulMiddle;
+                }
+                else
+                {
+                    ulYoung = ulMiddle;
+                }
+            }
+        }
+        else
+        {
+            //
+            // The cursor's sample is still old enough and only younger samples can have become so since.
+            //
+            while (((rLevel.ulCount - ulIndex) > 1u) && (GetAgeUs(rLevel, ulIndex + 1u) >= ullHorizonUs))
+            {
+                ++ulIndex;
+            }
+        }
+
+        rulLevel = ulLevel;
+        rulSlot = ulIndex & SLOT_MASK;
+    }
+
+    m_aulCursorLevels[ulHorizon] = ulLevel;
+    m_aulCursorIndexes[ulHorizon] = ulIndex;
+
+    return bFound;
+}
+
+} // SignalChain
+#endif // #if !defined(MULTI_HORIZON_RATE_OF_CHANGE_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
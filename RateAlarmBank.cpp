@@ -0,0 +1,305 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateAlarmBank.cpp
+///
+/// Implementation of the RateAlarmBank class
+///
+/// @see RateAlarmBank.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Infinite rates are treated like NaN rather than as beyond a limit
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <math.h>
+#include <string.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "RateAlarmBank.hpp"
+#include "FloatLib.hpp"
+
+namespace SignalChain
+{
+
+// FORWARD REFERENCES
+// (none)
+
+//**********************************************************************************************************************
+// Public methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateAlarmBank::RateAlarmBank
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+RateAlarmBank::RateAlarmBank(const RateAlarmArrays & rArrays, uint32_t ulChannelCount)
+    : m_Arrays(rArrays),
+      m_ulChannelCount(ulChannelCount)
+{
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        m_Arrays.pfHighLimits[ulChannel] = App::FLOAT_INFINITY;
+        m_Arrays.pfLowLimits[ulChannel] = -App::FLOAT_INFINITY;
+        m_Arrays.pfDeadbands[ulChannel] = 0.0f;
+        m_Arrays.puwDelayScans[ulChannel] = 1u;
+    }
+
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateAlarmBank::SetLimits
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool RateAlarmBank::SetLimits(uint32_t ulChannel, float fLowLimit, float fHighLimit, float fDeadband,
+                              uint16_t uwDelayScans)
+{
+    // Comparisons with NaN are false, so NaN limits fail the ordering test
+    bool bValid = (ulChannel < m_ulChannelCount) &&
+                  (fLowLimit <= fHighLimit) &&
+                  App::IsFinite(fDeadband) && (fDeadband >= 0.0f) &&
+                  (uwDelayScans <= MAX_DELAY_SCANS);
+
+    if (bValid)
+    {
+        m_Arrays.pfHighLimits[ulChannel] = fHighLimit;
+        m_Arrays.pfLowLimits[ulChannel] = fLowLimit;
+        m_Arrays.pfDeadbands[ulChannel] = fDeadband;
+        m_Arrays.puwDelayScans[ulChannel] = (uwDelayScans != 0u) ? uwDelayScans : 1u;
+        m_Arrays.pswDelayCounts[ulChannel] = 0;
+        m_Arrays.pubStates[ulChannel] = RATE_ALARM_NORMAL;
+
+        UpdateHoldBand(ulChannel);
+    }
+
+    return bValid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateAlarmBank::Evaluate
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t RateAlarmBank::Evaluate(const float * pfRates, RateAlarmEvent * pEvents, uint32_t ulMaxEvents)
+{
+    const float * pfHoldLows = m_Arrays.pfHoldLows;
+    const float * pfHoldHighs = m_Arrays.pfHoldHighs;
+    RateAlarmEvent * pNextEvent = pEvents;
+    RateAlarmEvent * pEventsEnd = pEvents + ulMaxEvents;
+    uint32_t ulChannel = 0;
+
+    //
+    // Only channels whose rate is outside the hold band, or NaN, or infinite beyond a finite hold band, have anything
+    // to do.  Each vector of channels is tested with ordered compares and the lanes that fail go through the scalar
+    // state machine.
+    //
+#if defined(__AVX2__)
+    for (; (ulChannel + 8) <= m_ulChannelCount; ulChannel += 8)
+    {
+        __m256 vRates = _mm256_loadu_ps(pfRates + ulChannel);
+        __m256 vHeld = _mm256_and_ps(_mm256_cmp_ps(vRates, _mm256_loadu_ps(pfHoldLows + ulChannel), _CMP_GE_OQ),
+                                     _mm256_cmp_ps(vRates, _mm256_loadu_ps(pfHoldHighs + ulChannel), _CMP_LE_OQ));
+
+        uint32_t ulActive = static_cast<uint32_t>(~_mm256_movemask_ps(vHeld)) & 0xFFu;
+
+        while (ulActive != 0u)
+        {
+            uint32_t ulLane = static_cast<uint32_t>(__builtin_ctz(ulActive));
+
+            ulActive &= ulActive - 1u;
+
+            if (EvaluateChannel(ulChannel + ulLane, pfRates[ulChannel + ulLane],
+                                (pNextEvent != pEventsEnd) ? pNextEvent : 0))
+            {
+                ++pNextEvent;
+            }
+        }
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    for (; (ulChannel + 4) <= m_ulChannelCount; ulChannel += 4)
+    {
+        float32x4_t vRates = vld1q_f32(pfRates + ulChannel);
+        uint32x4_t  vHeld = vandq_u32(vcgeq_f32(vRates, vld1q_f32(pfHoldLows + ulChannel)),
+                                      vcleq_f32(vRates, vld1q_f32(pfHoldHighs + ulChannel)));
+
+        if (vminvq_u32(vHeld) == 0u)
+        {
+            for (uint32_t ulLane = ulChannel; ulLane < (ulChannel + 4); ++ulLane)
+            {
+                if (!((pfRates[ulLane] >= pfHoldLows[ulLane]) && (pfRates[ulLane] <= pfHoldHighs[ulLane])) &&
+                    EvaluateChannel(ulLane, pfRates[ulLane], (pNextEvent != pEventsEnd) ? pNextEvent : 0))
+                {
+                    ++pNextEvent;
+                }
+            }
+        }
+    }
+#endif
+
+    //
+    // Scalar fallback and vector tail.
+    //
+    for (; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        float fRate = pfRates[ulChannel];
+
+        if (!((fRate >= pfHoldLows[ulChannel]) && (fRate <= pfHoldHighs[ulChannel])) &&
+            EvaluateChannel(ulChannel, fRate, (pNextEvent != pEventsEnd) ? pNextEvent : 0))
+        {
+            ++pNextEvent;
+        }
+    }
+
+    return static_cast<uint32_t>(pNextEvent - pEvents);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateAlarmBank::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateAlarmBank::Reset(void)
+{
+    memset(m_Arrays.pswDelayCounts, 0, m_ulChannelCount * sizeof(int16_t));
+
+    memset(m_Arrays.pubStates, RATE_ALARM_NORMAL, m_ulChannelCount * sizeof(uint8_t));
+
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        UpdateHoldBand(ulChannel);
+    }
+}
+
+//**********************************************************************************************************************
+// Private methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateAlarmBank::EvaluateChannel
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool RateAlarmBank::EvaluateChannel(uint32_t ulChannel, float fRate, RateAlarmEvent * pEvent)
+{
+    RateAlarmState eState = static_cast<RateAlarmState>(m_Arrays.pubStates[ulChannel]);
+    RateAlarmState eNextState = eState;
+    int32_t lDelayCount = m_Arrays.pswDelayCounts[ulChannel];
+    int32_t lDelayScans = m_Arrays.puwDelayScans[ulChannel];
+    bool bEvent = false;
+
+    if (!App::IsFinite(fRate))
+    {
+        // NaN, or the infinity RateOfChange returns for equal timestamps, which is no rate at all.  Neither raises
+        // nor clears, and a delay-on count starts again.
+        lDelayCount = 0;
+    }
+    else if (eState == RATE_ALARM_NORMAL)
+    {
+        // Count consecutive scans beyond one limit, saturating at the delay-on
+        if (fRate > m_Arrays.pfHighLimits[ulChannel])
+        {
+            lDelayCount = (lDelayCount > 0) ? ((lDelayCount < lDelayScans) ? (lDelayCount + 1) : lDelayScans) : 1;
+        }
+        else if (fRate < m_Arrays.pfLowLimits[ulChannel])
+        {
+            lDelayCount = (lDelayCount < 0) ? ((lDelayCount > -lDelayScans) ? (lDelayCount - 1) : -lDelayScans) : -1;
+        }
+        else
+        {
+            lDelayCount = 0;
+        }
+
+        if (lDelayCount >= lDelayScans)
+        {
+            eNextState = RATE_ALARM_HIGH;
+        }
+        else if (lDelayCount <= -lDelayScans)
+        {
+            eNextState = RATE_ALARM_LOW;
+        }
+    }
+    else if (eState == RATE_ALARM_HIGH)
+    {
+        if (fRate <= (m_Arrays.pfHighLimits[ulChannel] - m_Arrays.pfDeadbands[ulChannel]))
+        {
+            eNextState = RATE_ALARM_NORMAL;
+        }
+    }
+    else
+    {
+        if (fRate >= (m_Arrays.pfLowLimits[ulChannel] + m_Arrays.pfDeadbands[ulChannel]))
+        {
+            eNextState = RATE_ALARM_NORMAL;
+        }
+    }
+
+    //
+    // Without room for the event the change waits, with the delay-on count held at its end, for the next scan.
+    //
+    if ((eNextState != eState) && (pEvent != 0))
+    {
+        pEvent->ulChannel = ulChannel;
+        pEvent->eState = eNextState;
+        pEvent->ePrevious = eState;
+        pEvent->fRate = fRate;
+
+        m_Arrays.pubStates[ulChannel] = static_cast<uint8_t>(eNextState);
+        lDelayCount = 0;
+        bEvent = true;
+    }
+
+    m_Arrays.pswDelayCounts[ulChannel] = static_cast<int16_t>(lDelayCount);
+
+    UpdateHoldBand(ulChannel);
+
+    return bEvent;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateAlarmBank::UpdateHoldBand
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateAlarmBank::UpdateHoldBand(uint32_t ulChannel)
+{
+    float fHoldLow = App::FLOAT_INFINITY;
+    float fHoldHigh = -App::FLOAT_INFINITY;
+
+    if (m_Arrays.pswDelayCounts[ulChannel] != 0)
+    {
+        // Empty while a delay-on count runs, every scan has to advance or break it
+    }
+    else if (m_Arrays.pubStates[ulChannel] == RATE_ALARM_NORMAL)
+    {
+        fHoldLow = m_Arrays.pfLowLimits[ulChannel];
+        fHoldHigh = m_Arrays.pfHighLimits[ulChannel];
+    }
+    else if (m_Arrays.pubStates[ulChannel] == RATE_ALARM_HIGH)
+    {
+        // Held while strictly above the clear threshold, the next float up is the lowest such rate
+        float fClear = m_Arrays.pfHighLimits[ulChannel] - m_Arrays.pfDeadbands[ulChannel];
+
+        fHoldLow = nextafterf(fClear, App::FLOAT_INFINITY);
+        fHoldHigh = App::FLOAT_INFINITY;
+    }
+    else
+    {
+        fHoldLow = -App::FLOAT_INFINITY;
+        float fClear = m_Arrays.pfLowLimits[ulChannel] + m_Arrays.pfDeadbands[ulChannel];
+
+        fHoldHigh = nextafterf(fClear, -App::FLOAT_INFINITY);
+    }
+
+    m_Arrays.pfHoldLows[ulChannel] = fHoldLow;
+    m_Arrays.pfHoldHighs[ulChannel] = fHoldHigh;
+}
+
+} // SignalChain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
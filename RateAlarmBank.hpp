@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateAlarmBank.hpp
+///
+/// For evaluating rate of change alarms on many channels at once
+///
+/// @par Full Description
+/// Class header for the RateAlarmBank class and its statically sized StaticRateAlarmBank storage.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Infinite rates are treated like NaN rather than as beyond a limit
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(RATE_ALARM_BANK_HPP)
+#define RATE_ALARM_BANK_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    // Alarm state of a channel
+    enum RateAlarmState
+    {
+        RATE_ALARM_NORMAL = 0,  ///< Rate within the limits
+        RATE_ALARM_HIGH   = 1,  ///< Rate rising faster than the high limit
+        RATE_ALARM_LOW    = 2   ///< Rate falling faster than the low limit
+    };
+
+    // A change of alarm state of one channel
+    struct RateAlarmEvent
+    {
+        uint32_t       ulChannel;   ///< Channel that changed
+        RateAlarmState eState;      ///< State entered
+        RateAlarmState ePrevious;   ///< State left
+        float          fRate;       ///< Rate of change that caused the change
+    };
+
+    // Per channel arrays of a RateAlarmBank, element i of each belongs to channel i
+    struct RateAlarmArrays
+    {
+        float *    pfHighLimits;    ///< Rate above which the high alarm raises
+        float *    pfLowLimits;     ///< Rate below which the low alarm raises
+        float *    pfDeadbands;     ///< Hysteresis between raising and clearing
+        float *    pfHoldLows;      ///< Lowest rate keeping the current state with nothing to do
+        float *    pfHoldHighs;     ///< Highest rate keeping the current state with nothing to do
+        uint16_t * puwDelayScans;   ///< Consecutive scans beyond a limit needed to raise its alarm
+        int16_t *  pswDelayCounts;  ///< Scans counted so far, positive towards high and negative towards low
+        uint8_t *  pubStates;       ///< RateAlarmState
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: RateAlarmBank
+    ///
+    /// For evaluating high and low rate of change alarms of a bank of channels in one call per scan
+    ///
+    /// @par Full Description
+    /// Typically fed the rates from a RateOfChangeBank scan.  Limits are in the units of the rates passed in.
+    ///
+    /// A channel raises its high alarm once its rate has been above the high limit for its delay-on count of
+    /// consecutive scans, and clears it once the rate falls to the high limit less the deadband or below.  The low
+    /// alarm mirrors this.  A NaN or infinite rate neither raises nor clears an alarm, and interrupts a delay-on
+    /// count.  RateOfChange returns App::FLOAT_INFINITY for two samples on the same timestamp whatever the sign of
+    /// the change, so an infinity says nothing about the direction of the rate and is not taken as beyond a limit.
+    ///
+    /// Each channel also keeps a hold band, the range of rates for which a scan leaves it exactly as it is: within
+    /// the limits when normal, beyond the clear threshold when in alarm, and empty while a delay-on count is running.
+    /// A scan compares every rate with its hold band several channels at a time with SIMD compares and only visits
+    /// the channels outside it, so a scan of a plant in steady state is a pass of vector compares with no stores.
+    ///
+    /// Events are reported only on changes of state, into a buffer supplied by the caller.  When the buffer is full
+    /// a channel due to change state is left as it is, and changes on the next scan if its rate still calls for it.
+    ///
+    /// The bank does not own its storage.  Use StaticRateAlarmBank to get a bank with its arrays embedded, or supply
+    /// arrays of at least ulChannelCount elements to the constructor.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class RateAlarmBank
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Longest delay-on, the delay-on count is signed 16 bit
+        static const uint16_t MAX_DELAY_SCANS = 0x7FFFu;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::RateAlarmBank
+        ///
+        /// Constructor, every channel starts normal with its limits disabled.
+        ///
+        /// @param  [in]  rArrays           Storage for the per channel arrays.
+        /// @param  [in]  ulChannelCount    Number of channels in the bank.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RateAlarmBank(const RateAlarmArrays & rArrays, uint32_t ulChannelCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::~RateAlarmBank
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~RateAlarmBank() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::SetLimits
+        ///
+        /// Configure the alarm of one channel and return it to normal without an event.
+        ///
+        /// @param  [in]  ulChannel     Channel to configure.
+        /// @param  [in]  fLowLimit     Low alarm limit, -App::FLOAT_INFINITY to disable the low alarm.
+        /// @param  [in]  fHighLimit    High alarm limit, App::FLOAT_INFINITY to disable the high alarm.
+        /// @param  [in]  fDeadband     Hysteresis, finite and 0 or more.
+        /// @param  [in]  uwDelayScans  Consecutive scans beyond a limit needed to raise its alarm, 0 the same as 1,
+        ///                             at most MAX_DELAY_SCANS.
+        ///
+        /// @return whether the configuration was accepted
+        /// @retval true:  configured
+        /// @retval false: channel out of range, a limit is NaN, fLowLimit > fHighLimit, fDeadband is negative or
+        ///                not finite, or uwDelayScans is too large
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool SetLimits(uint32_t ulChannel, float fLowLimit, float fHighLimit, float fDeadband, uint16_t uwDelayScans);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::Evaluate
+        ///
+        /// Evaluate one scan of rates against the alarm limits.
+        ///
+        /// @pre    pfRates holds GetChannelCount() elements.
+        /// @post   Channel states updated and their changes written to pEvents in channel order.
+        ///
+        /// @param  [in]  pfRates       Rate of change of each channel.
+        /// @param  [out] pEvents       Buffer for the changes of state.
+        /// @param  [in]  ulMaxEvents   Capacity of pEvents.
+        ///
+        /// @return number of events written
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t Evaluate(const float * pfRates, RateAlarmEvent * pEvents, uint32_t ulMaxEvents);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::Reset
+        ///
+        /// Return every channel to normal without events, keeping the limits.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::GetState
+        ///
+        /// @param  [in]  ulChannel   Channel, less than GetChannelCount().
+        ///
+        /// @return alarm state of the channel
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RateAlarmState GetState(uint32_t ulChannel) const
+        {
+            return static_cast<RateAlarmState>(m_Arrays.pubStates[ulChannel]);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::GetChannelCount
+        ///
+        /// @return Number of channels in the bank
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetChannelCount(void) const { return m_ulChannelCount; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // (none)
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::EvaluateChannel
+        ///
+        /// Scalar state machine of one channel whose rate is outside its hold band.
+        ///
+        /// @param  [in]  ulChannel   Channel to evaluate.
+        /// @param  [in]  fRate       Rate of change of the channel.
+        /// @param  [out] pEvent      Where to report a change of state, NULL when the event buffer is full.
+        ///
+        /// @return whether an event was written to pEvent
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool EvaluateChannel(uint32_t ulChannel, float fRate, RateAlarmEvent * pEvent);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateAlarmBank::UpdateHoldBand
+        ///
+        /// Set the hold band of a channel from its state, limits and delay-on count.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void UpdateHoldBand(uint32_t ulChannel);
+
+        // Inhibit copy constructor and assignment operator, the storage pointers must not be shared
+        RateAlarmBank(RateAlarmBank &);
+
+        RateAlarmBank & operator=(RateAlarmBank const&);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Per channel arrays
+        RateAlarmArrays m_Arrays;
+
+        // Number of channels
+        uint32_t        m_ulChannelCount;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticRateAlarmBankStorage
+    ///
+    /// Arrays backing a StaticRateAlarmBank.  A separate base class so the arrays exist before the RateAlarmBank
+    /// constructor initializes them.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticRateAlarmBankStorage
+{
+    protected:
+        alignas(32) float    m_afHighLimits[CHANNEL_COUNT];
+        alignas(32) float    m_afLowLimits[CHANNEL_COUNT];
+        alignas(32) float    m_afDeadbands[CHANNEL_COUNT];
+        alignas(32) float    m_afHoldLows[CHANNEL_COUNT];
+        alignas(32) float    m_afHoldHighs[CHANNEL_COUNT];
+        uint16_t             m_auwDelayScans[CHANNEL_COUNT];
+        int16_t              m_aswDelayCounts[CHANNEL_COUNT];
+        uint8_t              m_aubStates[CHANNEL_COUNT];
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: StaticRateAlarmBankStorage::GetArrays
+        ///
+        /// @return the embedded arrays
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RateAlarmArrays GetArrays(void)
+        {
+            RateAlarmArrays Arrays = { m_afHighLimits, m_afLowLimits, m_afDeadbands, m_afHoldLows, m_afHoldHighs,
+                                       m_auwDelayScans, m_aswDelayCounts, m_aubStates };
+
+            return Arrays;
+        }
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticRateAlarmBank
+    ///
+    /// RateAlarmBank with embedded storage for CHANNEL_COUNT channels
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticRateAlarmBank : private StaticRateAlarmBankStorage<CHANNEL_COUNT>, public RateAlarmBank
+{
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: StaticRateAlarmBank::StaticRateAlarmBank
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        StaticRateAlarmBank()
+            : RateAlarmBank(this->GetArrays(), CHANNEL_COUNT)
+        {
+        }
+};
+} // SignalChain
+#endif // #if !defined(RATE_ALARM_BANK_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateExceptionReporter.cpp
+///
+/// Implementation of the RateExceptionReporter class
+///
+/// @see RateExceptionReporter.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <math.h>
+#include <string.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "RateExceptionReporter.hpp"
+#include "FloatLib.hpp"
+
+namespace SignalChain
+{
+
+// FORWARD REFERENCES
+// (none)
+
+//**********************************************************************************************************************
+// Public methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateExceptionReporter::RateExceptionReporter
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+RateExceptionReporter::RateExceptionReporter(const RateExceptionArrays & rArrays, uint32_t ulChannelCount)
+    : m_Arrays(rArrays),
+      m_ulChannelCount(ulChannelCount),
+      m_ulScan(0)
+{
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        m_Arrays.pfAbsoluteDeadbands[ulChannel] = 0.0f;
+        m_Arrays.pfRelativeDeadbands[ulChannel] = 0.0f;
+        m_Arrays.pulHeartbeatScans[ulChannel] = 0u;
+        m_Arrays.pulReportScans[ulChannel] = 0u;
+    }
+
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateExceptionReporter::SetDeadband
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool RateExceptionReporter::SetDeadband(uint32_t ulChannel, float fAbsolute, float fPercent, uint32_t ulHeartbeatScans)
+{
+    bool bValid = (ulChannel < m_ulChannelCount) &&
+                  App::IsFinite(fAbsolute) && (fAbsolute >= 0.0f) &&
+                  App::IsFinite(fPercent) && (fPercent >= 0.0f);
+
+    if (bValid)
+    {
+        m_Arrays.pfAbsoluteDeadbands[ulChannel] = fAbsolute;
+        m_Arrays.pfRelativeDeadbands[ulChannel] = fPercent * 0.01f;
+        m_Arrays.pulHeartbeatScans[ulChannel] = ulHeartbeatScans;
+
+        UpdateHoldBand(ulChannel);
+    }
+
+    return bValid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateExceptionReporter::Evaluate
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t RateExceptionReporter::Evaluate(const float * pfRates, uint32_t * pulChanged, uint32_t ulMaxChanged)
+{
+    uint32_t ulChanged = 0;
+    uint32_t ulChannel = 0;
+
+    //
+    // Only channels whose rate is outside the hold band, or NaN, or whose heartbeat is due have anything to do.
+    // Each vector of channels is tested with ordered float compares and unsigned silence compares, and the lanes
+    // that fail go to the scalar check.
+    //
+    const float * pfHoldLows = m_Arrays.pfHoldLows;
+    const float * pfHoldHighs = m_Arrays.pfHoldHighs;
+    const uint32_t * pulHeartbeatScans = m_Arrays.pulHeartbeatScans;
+    const uint32_t * pulReportScans = m_Arrays.pulReportScans;
+
+#if defined(__AVX2__)
+    const __m256i vScan = _mm256_set1_epi32(static_cast<int32_t>(m_ulScan));
+    const __m256i vZero = _mm256_setzero_si256();
+
+    for (; (ulChannel + 8) <= m_ulChannelCount; ulChannel += 8)
+    {
+        __m256 vRates = _mm256_loadu_ps(pfRates + ulChannel);
+        __m256 vHeld = _mm256_and_ps(_mm256_cmp_ps(vRates, _mm256_loadu_ps(pfHoldLows + ulChannel), _CMP_GE_OQ),
+                                     _mm256_cmp_ps(vRates, _mm256_loadu_ps(pfHoldHighs + ulChannel), _CMP_LE_OQ));
+
+        // Silence at or beyond the heartbeat, through an unsigned max, on the channels that have one
+        __m256i vHeartbeat = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pulHeartbeatScans + ulChannel));
+        __m256i vSilence = _mm256_sub_epi32(vScan,
+                                            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pulReportScans +
+                                                                                                 ulChannel)));
+        __m256i vDue = _mm256_andnot_si256(_mm256_cmpeq_epi32(vHeartbeat, vZero),
+                                           _mm256_cmpeq_epi32(_mm256_max_epu32(vSilence, vHeartbeat), vSilence));
+
+        uint32_t ulActive = static_cast<uint32_t>(~_mm256_movemask_ps(_mm256_andnot_ps(_mm256_castsi256_ps(vDue),
+                                                                                       vHeld))) & 0xFFu;
+
+        while (ulActive != 0u)
+        {
+            uint32_t ulLane = static_cast<uint32_t>(__builtin_ctz(ulActive));
+
+            ulActive &= ulActive - 1u;
+
+            if (EvaluateChannel(ulChannel + ulLane, pfRates[ulChannel + ulLane], ulChanged < ulMaxChanged))
+            {
+                pulChanged[ulChanged++] = ulChannel + ulLane;
+            }
+        }
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    const uint32x4_t vScan = vdupq_n_u32(m_ulScan);
+
+    for (; (ulChannel + 4) <= m_ulChannelCount; ulChannel += 4)
+    {
+        float32x4_t vRates = vld1q_f32(pfRates + ulChannel);
+        uint32x4_t  vHeld = vandq_u32(vcgeq_f32(vRates, vld1q_f32(pfHoldLows + ulChannel)),
+                                      vcleq_f32(vRates, vld1q_f32(pfHoldHighs + ulChannel)));
+        uint32x4_t  vHeartbeat = vld1q_u32(pulHeartbeatScans + ulChannel);
+        uint32x4_t  vDue = vandq_u32(vtstq_u32(vHeartbeat, vHeartbeat),
+                                     vcgeq_u32(vsubq_u32(vScan, vld1q_u32(pulReportScans + ulChannel)), vHeartbeat));
+
+        if (vminvq_u32(vbicq_u32(vHeld, vDue)) == 0u)
+        {
+            for (uint32_t ulLane = ulChannel; ulLane < (ulChannel + 4); ++ulLane)
+            {
+                if (EvaluateChannel(ulLane, pfRates[ulLane], ulChanged < ulMaxChanged))
+                {
+                    pulChanged[ulChanged++] = ulLane;
+                }
+            }
+        }
+    }
+#endif
+
+    //
+    // Scalar fallback and vector tail.
+    //
+    for (; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        float    fRate = pfRates[ulChannel];
+        uint32_t ulHeartbeatScans = pulHeartbeatScans[ulChannel];
+        bool     bHeld = (fRate >= pfHoldLows[ulChannel]) && (fRate <= pfHoldHighs[ulChannel]) &&
+                         ((ulHeartbeatScans == 0u) || ((m_ulScan - pulReportScans[ulChannel]) < ulHeartbeatScans));
+
+        if (!bHeld && EvaluateChannel(ulChannel, fRate, ulChanged < ulMaxChanged))
+        {
+            pulChanged[ulChanged++] = ulChannel;
+        }
+    }
+
+    ++m_ulScan;
+
+    return ulChanged;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateExceptionReporter::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateExceptionReporter::Reset(void)
+{
+    memset(m_Arrays.pubReported, 0, m_ulChannelCount * sizeof(uint8_t));
+
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        m_Arrays.pfLastReported[ulChannel] = App::FLOAT_NAN;
+
+        UpdateHoldBand(ulChannel);
+    }
+}
+
+//**********************************************************************************************************************
+// Private methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateExceptionReporter::EvaluateChannel
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool RateExceptionReporter::EvaluateChannel(uint32_t ulChannel, float fRate, bool bRoom)
+{
+    uint32_t ulHeartbeatScans = m_Arrays.pulHeartbeatScans[ulChannel];
+
+    bool bHeld = ((fRate >= m_Arrays.pfHoldLows[ulChannel]) && (fRate <= m_Arrays.pfHoldHighs[ulChannel])) ||
+                 (App::IsNan(fRate) && App::IsNan(m_Arrays.pfLastReported[ulChannel]));
+    bool bHeartbeat = (ulHeartbeatScans != 0u) &&
+                      ((m_ulScan - m_Arrays.pulReportScans[ulChannel]) >= ulHeartbeatScans);
+    bool bReport = bRoom && ((m_Arrays.pubReported[ulChannel] == 0u) || !bHeld || bHeartbeat);
+
+    if (bReport)
+    {
+        m_Arrays.pfLastReported[ulChannel] = fRate;
+        m_Arrays.pulReportScans[ulChannel] = m_ulScan;
+        m_Arrays.pubReported[ulChannel] = 1u;
+
+        UpdateHoldBand(ulChannel);
+    }
+
+    return bReport;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateExceptionReporter::UpdateHoldBand
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateExceptionReporter::UpdateHoldBand(uint32_t ulChannel)
+{
+    float fLastReported = m_Arrays.pfLastReported[ulChannel];
+    float fHoldLow = App::FLOAT_INFINITY;
+    float fHoldHigh = -App::FLOAT_INFINITY;
+
+    if (m_Arrays.pubReported[ulChannel] == 0u)
+    {
+        // Empty until the first report
+    }
+    else if (App::IsFinite(fLastReported))
+    {
+        float fDeadband = fabsf(fLastReported) * m_Arrays.pfRelativeDeadbands[ulChannel];
+
+        fDeadband = (fDeadband > m_Arrays.pfAbsoluteDeadbands[ulChannel]) ?
+                    fDeadband : m_Arrays.pfAbsoluteDeadbands[ulChannel];
+
+        fHoldLow = fLastReported - fDeadband;
+        fHoldHigh = fLastReported + fDeadband;
+    }
+    else if (App::IsInf(fLastReported))
+    {
+        // Held while the rate stays the same infinity
+        fHoldLow = fLastReported;
+        fHoldHigh = fLastReported;
+    }
+    else
+    {
+        // Empty after a NaN, the NaN test is left to EvaluateChannel
+    }
+
+    m_Arrays.pfHoldLows[ulChannel] = fHoldLow;
+    m_Arrays.pfHoldHighs[ulChannel] = fHoldHigh;
+}
+
+} // SignalChain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
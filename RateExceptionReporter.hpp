@@ -0,0 +1,276 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateExceptionReporter.hpp
+///
+/// For reporting rates of change by exception
+///
+/// @par Full Description
+/// Class header for the RateExceptionReporter class and its statically sized StaticRateExceptionReporter storage.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(RATE_EXCEPTION_REPORTER_HPP)
+#define RATE_EXCEPTION_REPORTER_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    // Per channel arrays of a RateExceptionReporter, element i of each belongs to channel i
+    struct RateExceptionArrays
+    {
+        float *    pfAbsoluteDeadbands; ///< Change from the last report that is not reported
+        float *    pfRelativeDeadbands; ///< The same as a fraction of the magnitude of the last report
+        float *    pfLastReported;      ///< Rate last reported
+        float *    pfHoldLows;          ///< Lowest rate that is not reported
+        float *    pfHoldHighs;         ///< Highest rate that is not reported
+        uint32_t * pulHeartbeatScans;   ///< Longest silence in scans, 0 for none
+        uint32_t * pulReportScans;      ///< Scan of the last report
+        uint8_t *  pubReported;         ///< Whether the channel has been reported since reset
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: RateExceptionReporter
+    ///
+    /// For reporting the rates of a bank of channels by exception, in one call per scan
+    ///
+    /// @par Full Description
+    /// Typically fed the rates from a RateOfChangeBank scan, and followed by the historian or network publisher,
+    /// which then only reads the channels in the changed list instead of every rate every scan.
+    ///
+    /// A channel is reported on its first scan after reset, when its rate leaves the deadband around the rate last
+    /// reported, when its rate becomes or stops being NaN, and when it has not been reported for its heartbeat
+    /// number of scans.  The deadband is the larger of an absolute deadband and a percentage of the magnitude of the
+    /// last report, so a channel can be configured with either or both.  A deadband of 0 reports every change.
+    /// Successive NaN rates are one NaN, and an infinite rate is reported once until it changes.
+    ///
+    /// The deadband is kept as a hold band, the closed range of rates around the last report that are not reported.
+    /// A scan compares every rate with its hold band and every silence with its heartbeat several channels at a time
+    /// with SIMD compares and only visits the channels that fail, so a scan of a plant in steady state is a pass of
+    /// vector compares with no stores.
+    ///
+    /// The changed channels are written in channel order into a list supplied by the caller.  When the list is full
+    /// a channel due to be reported is left as it is, and is reported on the next scan if it is still due.
+    ///
+    /// The reporter does not own its storage.  Use StaticRateExceptionReporter to get a reporter with its arrays
+    /// embedded, or supply arrays of at least ulChannelCount elements to the constructor.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class RateExceptionReporter
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::RateExceptionReporter
+        ///
+        /// Constructor, every channel reports every change with no heartbeat, and is reported on the first scan.
+        ///
+        /// @param  [in]  rArrays           Storage for the per channel arrays.
+        /// @param  [in]  ulChannelCount    Number of channels.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RateExceptionReporter(const RateExceptionArrays & rArrays, uint32_t ulChannelCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::~RateExceptionReporter
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~RateExceptionReporter() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::SetDeadband
+        ///
+        /// Configure the reporting of one channel.  The hold band moves to the new deadband around the rate last
+        /// reported, without a report.
+        ///
+        /// @param  [in]  ulChannel         Channel to configure.
+        /// @param  [in]  fAbsolute         Absolute deadband in the units of the rates, finite and 0 or more.
+        /// @param  [in]  fPercent          Deadband as a percentage of the last report, finite and 0 or more.
+        /// @param  [in]  ulHeartbeatScans  Scans after which an unchanged rate is reported again, 0 for never.
+        ///
+        /// @return whether the configuration was accepted
+        /// @retval true:  configured
+        /// @retval false: channel out of range, or a deadband is negative or not finite
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool SetDeadband(uint32_t ulChannel, float fAbsolute, float fPercent, uint32_t ulHeartbeatScans);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::Evaluate
+        ///
+        /// Evaluate one scan of rates and list the channels to report.
+        ///
+        /// @pre    pfRates holds GetChannelCount() elements.
+        /// @post   Reported rates recorded and their channels written to pulChanged in channel order.
+        ///
+        /// @param  [in]  pfRates       Rate of change of each channel.
+        /// @param  [out] pulChanged    Buffer for the channels to report.
+        /// @param  [in]  ulMaxChanged  Capacity of pulChanged.
+        ///
+        /// @return number of channels written
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t Evaluate(const float * pfRates, uint32_t * pulChanged, uint32_t ulMaxChanged);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::Reset
+        ///
+        /// Report every channel on the next scan, keeping the deadbands.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::GetLastReported
+        ///
+        /// @param  [in]  ulChannel   Channel, less than GetChannelCount().
+        ///
+        /// @return rate last reported for the channel, what the consumers of the reports hold
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float GetLastReported(uint32_t ulChannel) const { return m_Arrays.pfLastReported[ulChannel]; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::GetChannelCount
+        ///
+        /// @return Number of channels
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetChannelCount(void) const { return m_ulChannelCount; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // (none)
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::EvaluateChannel
+        ///
+        /// Decide whether a channel that failed the vector compares is due, and record the report when there is room.
+        ///
+        /// @param  [in]  ulChannel   Channel to evaluate.
+        /// @param  [in]  fRate       Rate of change of the channel.
+        /// @param  [in]  bRoom       Whether the changed list has room.
+        ///
+        /// @return whether the channel was reported
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool EvaluateChannel(uint32_t ulChannel, float fRate, bool bRoom);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateExceptionReporter::UpdateHoldBand
+        ///
+        /// Set the hold band of a channel from its last report and deadbands.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void UpdateHoldBand(uint32_t ulChannel);
+
+        // Inhibit copy constructor and assignment operator, the storage pointers must not be shared
+        RateExceptionReporter(RateExceptionReporter &);
+
+        RateExceptionReporter & operator=(RateExceptionReporter const&);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Per channel arrays
+        RateExceptionArrays m_Arrays;
+
+        // Number of channels
+        uint32_t            m_ulChannelCount;
+
+        // Scans evaluated, free running
+        uint32_t            m_ulScan;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticRateExceptionReporterStorage
+    ///
+    /// Arrays backing a StaticRateExceptionReporter.  A separate base class so the arrays exist before the
+    /// RateExceptionReporter constructor initializes them.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticRateExceptionReporterStorage
+{
+    protected:
+        alignas(32) float    m_afAbsoluteDeadbands[CHANNEL_COUNT];
+        alignas(32) float    m_afRelativeDeadbands[CHANNEL_COUNT];
+        alignas(32) float    m_afLastReported[CHANNEL_COUNT];
+        alignas(32) float    m_afHoldLows[CHANNEL_COUNT];
+        alignas(32) float    m_afHoldHighs[CHANNEL_COUNT];
+        alignas(32) uint32_t m_aulHeartbeatScans[CHANNEL_COUNT];
+        alignas(32) uint32_t m_aulReportScans[CHANNEL_COUNT];
+        uint8_t              m_aubReported[CHANNEL_COUNT];
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: StaticRateExceptionReporterStorage::GetArrays
+        ///
+        /// @return the embedded arrays
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RateExceptionArrays GetArrays(void)
+        {
+            RateExceptionArrays Arrays = { m_afAbsoluteDeadbands, m_afRelativeDeadbands, m_afLastReported,
+                                           m_afHoldLows, m_afHoldHighs, m_aulHeartbeatScans, m_aulReportScans,
+                                           m_aubReported };
+
+            return Arrays;
+        }
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticRateExceptionReporter
+    ///
+    /// RateExceptionReporter with embedded storage for CHANNEL_COUNT channels
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticRateExceptionReporter : private StaticRateExceptionReporterStorage<CHANNEL_COUNT>,
+                                    public RateExceptionReporter
+{
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: StaticRateExceptionReporter::StaticRateExceptionReporter
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        StaticRateExceptionReporter()
+            : RateExceptionReporter(this->GetArrays(), CHANNEL_COUNT)
+        {
+        }
+};
+} // SignalChain
+#endif // #if !defined(RATE_EXCEPTION_REPORTER_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
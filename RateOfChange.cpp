@@ -8,6 +8,9 @@
 /// @if REVISION_HISTORY_INCLUDED
 /// @par Edit History
 /// - thaley1 14-Jun-2016 Original implementation
+/// - agent 16-Oct-2026 Added batch CalcRateOfChangeUs over sample buffers
+/// - agent 16-Oct-2026 Ms and Sec rates scale the elapsed time by a compile time unit constant
+/// - agent 16-Oct-2026 Calculation moved into BasicRateOfChange
 /// @endif
 ///
 /// @ingroup SignalChain
@@ -24,6 +27,7 @@
 // C++ PROJECT INCLUDES
 #include "RateOfChange.hpp"
 #include "FloatLib.hpp"
+#include "RateOfChangeKernel.hpp"
 
 namespace SignalChain
 {
@@ -38,7 +42,7 @@ namespace SignalChain
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// RateOfChange::RateOfChange
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-RateOfChange::RateOfChange() : m_fPreviousValue(0.0f), m_ulPreviousTimestampUs(0), m_bInitialCall(true)
+RateOfChange::RateOfChange() : BasicRateOfChange<TimeBaseUs32>()
 {
 
 }
@@ -48,57 +52,7 @@ RateOfChange::RateOfChange() : m_fPreviousValue(0.0f), m_ulPreviousTimestampUs(0
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 float RateOfChange::CalcRateOfChangeUs(float fCurrentValue, uint32_t ulCurrentTimestampUs)
 {
-
-	float fRateOfChange = 0.0f;
-
-	if (m_bInitialCall)
-    {
-        m_bInitialCall = false;
-    }
-    else
-    {
-        uint32_t ulDifference = 0;
-
-        // Init to INFINITY in case the current and previous timestamnps are equal which would result in a divide by Zero
-        fRateOfChange = App::FLOAT_INFINITY;
-
-        //
-        // If the current timestamp is less than the previous timestamp assume an overflow of the 32 bit fixed point number 
-        // occurred during the elapsed time from the previous timestamp to the current time stamp.
-        // The elapsed time is:
-        //
-        // largest unsigned int value - previous time stamp this is the time that elapsed before the overflow.
-        // +1 for the overflow from the larget value to 0.
-        // + the current timestamp to capture the amount of the overflow
-        //
-        if (ulCurrentTimestampUs < m_ulPreviousTimestampUs)
-        {
-            ulDifference = ULONG_MAX - m_ulPreviousTimestampUs + 1 + ulCurrentTimestampUs;
-        }
-        else
-        {
-            ulDifference = ulCurrentTimestampUs - m_ulPreviousTimestampUs;
-        }
-
-        //
-        // Do the division if the denominator is non zero.
-        //
-        if (ulDifference != 0)
-        {
-            fRateOfChange = (fCurrentValue - m_fPreviousValue) / static_cast<float>(ulDifference);
-        }
-    }
-    
-    //
-    // Update the previous timestamp and unit values for the caller 
-    // as now the provious timestamp and unit values are the current values upon input
-    // since the calculation is complete.
-    //
-    m_ulPreviousTimestampUs = ulCurrentTimestampUs;
-
-    m_fPreviousValue = fCurrentValue;
-
-    return fRateOfChange;
+    return CalcRateOfChange<RateUnitUs>(fCurrentValue, ulCurrentTimestampUs);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -106,17 +60,7 @@ float RateOfChange::CalcRateOfChangeUs(float fCurrentValue, uint32_t ulCurrentTi
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 float RateOfChange::CalcRateOfChangeMs(float fCurrentValue, uint32_t ulCurrentTimestampUs)
 {
-    // Conversion factor for converting from microseconds to milliseconds
-    static const float CONVERSION_US_TO_MS = 1000.0f;
-
-    float fChangeRateSec = CalcRateOfChangeUs(fCurrentValue, ulCurrentTimestampUs);
-
-    if (fChangeRateSec != App::FLOAT_INFINITY)
-    {
-        fChangeRateSec *= CONVERSION_US_TO_MS;
-    }
-
-    return fChangeRateSec;
+    return CalcRateOfChange<RateUnitMs>(fCurrentValue, ulCurrentTimestampUs);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,17 +68,36 @@ float RateOfChange::CalcRateOfChangeMs(float fCurrentValue, uint32_t ulCurrentTi
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 float RateOfChange::CalcRateOfChangeSec(float fCurrentValue, uint32_t ulCurrentTimestampUs)
 {
-    // Conversion factor for converting from microseconds to seconds
-    static const float CONVERSION_US_TO_SEC = 1000000.0f;
-
-    float fChangeRateSec = CalcRateOfChangeUs(fCurrentValue, ulCurrentTimestampUs);
+    return CalcRateOfChange<RateUnitSec>(fCurrentValue, ulCurrentTimestampUs);
+}
 
-    if (fChangeRateSec != App::FLOAT_INFINITY)
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateOfChange::CalcRateOfChangeUs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateOfChange::CalcRateOfChangeUs(const float *    pfCurrentValues,
+                                      const uint32_t * pulCurrentTimestampsUs,
+                                      float *          pfRates,
+                                      uint32_t         ulCount)
+{
+    if (ulCount != 0)
     {
-        fChangeRateSec *= CONVERSION_US_TO_SEC;
-    }
+        //
+        // The first sample depends on the state left by the previous call, including the initial call case, so it
+        // goes through the streaming path.
+        //
+        pfRates[0] = CalcRateOfChangeUs(pfCurrentValues[0], pulCurrentTimestampsUs[0]);
+
+        //
+        // Every later sample is differenced against its neighbour in the same buffer.
+        //
+        Kernel::CalcRatesUs(&pfCurrentValues[1], &pfCurrentValues[0],
+                            &pulCurrentTimestampsUs[1], &pulCurrentTimestampsUs[0],
+                            &pfRates[1], ulCount - 1);
 
-    return fChangeRateSec;
+        m_tPreviousTimestamp = pulCurrentTimestampsUs[ulCount - 1];
+
+        m_fPreviousValue = pfCurrentValues[ulCount - 1];
+    }
 }
 
 //**********************************************************************************************************************
@@ -4,12 +4,16 @@
 /// For computing rates of change
 ///
 /// @par Full Description
-/// Class header for the RateOfChange class.
+/// Class header for the RateOfChange class and the BasicRateOfChange class template it is built on.
 /// 
 ///
 /// @if REVISION_HISTORY_INCLUDED
 /// @par Edit History
 /// - thaley1 14-Jun-2016 Original implementation
+/// - agent 16-Oct-2026 Added batch CalcRateOfChangeUs over sample buffers
+/// - agent 16-Oct-2026 Added CalcRateOfChange templated on the output time unit, equal timestamps return a real
+///   infinity, no longer 2139095040.0f
+/// - agent 16-Oct-2026 Moved the calculation into BasicRateOfChange, templated on the time base
 /// @endif
 ///
 /// @ingroup SignalChain
@@ -28,7 +32,8 @@
 // (none)
 
 // C++ PROJECT INCLUDES
-// (none)
+#include "FloatLib.hpp"
+#include "TimeBase.hpp"
 
 namespace SignalChain
 {
@@ -36,6 +41,119 @@ namespace SignalChain
     // FORWARD REFERENCES
     // (none)
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // STRUCT NAME: RateUnitUs, RateUnitMs, RateUnitSec
+    ///
+    /// Output time units for RateOfChange::CalcRateOfChange
+    ///
+    /// @par Full Description
+    /// Each unit states how many of itself make up one second.  BasicRateOfChange folds the conversion from timestamp
+    /// ticks to the unit into a single compile time constant.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RateUnitUs
+{
+    static const uint32_t UNITS_PER_SECOND = 1000000U;
+};
+
+struct RateUnitMs
+{
+    static const uint32_t UNITS_PER_SECOND = 1000U;
+};
+
+struct RateUnitSec
+{
+    static const uint32_t UNITS_PER_SECOND = 1U;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: BasicRateOfChange
+    ///
+    /// For calculating rates of change against any time base
+    ///
+    /// @par Full Description
+    /// Holds the previous sample and calculates the rate of change between it and the current sample.  The timestamp
+    /// counter width and frequency come from the TimeBase parameter, so the same code serves 32 bit microsecond
+    /// timestamps on target and 64 bit nanosecond timestamps on high rate acquisition nodes.  The elapsed time is the
+    /// modulo difference of the timestamps, which handles a counter overflow with no compare.
+    ///
+    /// When the current and previous timestamps are equal the rate is undefined and App::FLOAT_INFINITY, a true IEEE
+    /// infinity, is returned.  Being a real infinity it passes through unit scaling unchanged, so callers test for it
+    /// with App::IsInf in every unit.
+    ///
+    /// This is a change of output: the original RateOfChange returned App::FLOAT_INFINITY when it held the finite
+    /// 2139095040.0f, the integer 0x7F800000 converted to float.  A caller that compared the rate with that value no
+    /// longer matches and must use App::IsInf.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TimeBase>
+class BasicRateOfChange
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Timestamp type of the time base
+        typedef typename TimeBase::Tick Tick;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicRateOfChange::BasicRateOfChange
+        ///
+        /// Constructor 
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BasicRateOfChange() : m_bInitialCall(true), m_fPreviousValue(0.0f), m_tPreviousTimestamp(0) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicRateOfChange::~BasicRateOfChange
+        ///
+        /// Destructor 
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~BasicRateOfChange() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicRateOfChange::CalcRateOfChange
+        ///
+        /// Calculate the rate of change between the previous value and the current value in units per RateUnit.
+        ///
+        /// @par Full Description
+        /// The output unit is a compile time parameter, one of RateUnitUs, RateUnitMs or RateUnitSec.  The elapsed
+        /// time is scaled into the output unit by a constant multiply ahead of the single division, so every unit has
+        /// the same cost and no sentinel compare is needed afterwards.  When the time base ticks in the output unit
+        /// the constant is exactly 1 and the multiply is removed by the compiler.
+        ///
+        /// @pre    none.
+        /// @post   Rate of change in RateUnit calculated.
+        /// 
+        /// @param  [in]  fCurrentValue          Current value for calculating rate of change.
+        /// @param  [in]  tCurrentTimestamp      Current timestamp in time base ticks for calculating rate of change.
+        ///
+        /// @return Calculated rate of change in units per RateUnit
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename RateUnit>
+        float CalcRateOfChange(float fCurrentValue, Tick tCurrentTimestamp);
+
+    protected:
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Initial call flag
+        bool     m_bInitialCall;
+        
+        // Previous Value
+        float    m_fPreviousValue;
+
+        // Previous timestamp
+        Tick     m_tPreviousTimestamp;
+};
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // CLASS NAME: RateOfChange
     ///
@@ -45,9 +163,11 @@ namespace SignalChain
     /// This class exposes methods for computing the rate of change in microseconds, milleseconds, and seconds.  There also
     /// is a method for delta time between two values that are inputs to the method
     ///
+    /// Timestamps are 32 bit microseconds.  Use BasicRateOfChange with another TimeBase for wider or faster counters.
+    ///
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-class RateOfChange 
+class RateOfChange : public BasicRateOfChange<TimeBaseUs32>
 {
     public:
         //**************************************************************************************************************
@@ -129,31 +249,85 @@ class RateOfChange
         /// @return Calculated rate of change in units per second
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float CalcRateOfChangeSec(float fCurrentValue, uint32_t ulCurrentTimestampUs);
-    private:
-        //**************************************************************************************************************
-        // Private definitions
-        //**************************************************************************************************************
-        
-        // (none)
 
-        //**************************************************************************************************************
-        // Private methods
-        //**************************************************************************************************************
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChange::CalcRateOfChangeUs
+        ///
+        /// Calculate the rate of change of every sample in a buffer in units per microsecond.
+        ///
+        /// @par Full Description
+        /// Batch form of CalcRateOfChangeUs for captured time series.  Sample i is differenced against sample i - 1,
+        /// and the first sample against the value and timestamp left by the previous call, so feeding a series in
+        /// consecutive buffers gives the same rates as feeding it one sample at a time.  Everything after the first
+        /// sample runs through the vectorized rate of change kernel and the results are bit-identical to the
+        /// streaming path, including timestamp overflow and equal timestamps.
+        ///
+        /// @pre    pfRates does not overlap pfCurrentValues or pulCurrentTimestampsUs.
+        /// @post   Rates of change calculated and the last sample stored as the previous one.
+        ///
+        /// @param  [in]  pfCurrentValues          Values for calculating rate of change.
+        /// @param  [in]  pulCurrentTimestampsUs   Timestamps in microseconds for calculating rate of change.
+        /// @param  [out] pfRates                  Calculated rates of change in units per microsecond.
+        /// @param  [in]  ulCount                  Number of samples in each buffer.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CalcRateOfChangeUs(const float *    pfCurrentValues,
+                                const uint32_t * pulCurrentTimestampsUs,
+                                float *          pfRates,
+                                uint32_t         ulCount);
+};
 
-        // (none)
-        //**************************************************************************************************************
-        // Member variables
-        //**************************************************************************************************************
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// BasicRateOfChange::CalcRateOfChange
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename TimeBase>
+template <typename RateUnit>
+inline float BasicRateOfChange<TimeBase>::CalcRateOfChange(float fCurrentValue, Tick tCurrentTimestamp)
+{
+    // Output units per tick of elapsed time, exactly 1 when the time base ticks in the output unit
+    constexpr float UNITS_PER_TICK = static_cast<float>(static_cast<double>(RateUnit::UNITS_PER_SECOND) /
+                                                        static_cast<double>(TimeBase::TICKS_PER_SECOND));
 
-        // Initial call flag
-        bool     m_bInitialCall;
-        
-        // Previous Value
-        float    m_fPreviousValue;
+    float fRateOfChange = 0.0f;
+
+    if (m_bInitialCall)
+    {
+        m_bInitialCall = false;
+    }
+    else
+    {
+        //
+        // If the current timestamp is less than the previous timestamp the counter overflowed during the elapsed
+        // time.  The modulo difference of the timestamps is then the time elapsed before the overflow plus the
+        // amount of the overflow, so no separate case is needed.
+        //
+        Tick tDifference = TimeBase::Elapsed(tCurrentTimestamp, m_tPreviousTimestamp);
+
+        // Init to INFINITY in case the current and previous timestamnps are equal which would result in a divide by Zero
+        fRateOfChange = App::FLOAT_INFINITY;
+
+        //
+        // Do the division if the denominator is non zero.
+        //
+        if (tDifference != 0)
+        {
+            fRateOfChange = (fCurrentValue - m_fPreviousValue) / (static_cast<float>(tDifference) * UNITS_PER_TICK);
+        }
+    }
+
+    //
+    // Update the previous timestamp and unit values for the caller 
+    // as now the provious timestamp and unit values are the current values upon input
+    // since the calculation is complete.
+    //
+    m_tPreviousTimestamp = tCurrentTimestamp;
+
+    m_fPreviousValue = fCurrentValue;
+
+    return fRateOfChange;
+}
 
-        // Previous timestamp
-        uint32_t m_ulPreviousTimestampUs;
-};
 } // SignalChain
 #endif // #if !defined(RATE_OF_CHANGE_HPP)
 
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateOfChangeBank.cpp
+///
+/// Implementation of the RateOfChangeBank class
+///
+/// @see RateOfChangeBank.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <string.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "RateOfChangeBank.hpp"
+#include "RateOfChangeKernel.hpp"
+
+namespace SignalChain
+{
+
+// FORWARD REFERENCES
+// (none)
+
+//**********************************************************************************************************************
+// Public methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateOfChangeBank::RateOfChangeBank
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+RateOfChangeBank::RateOfChangeBank(float *    pfPreviousValues,
+                                   uint32_t * pulPreviousTimestampsUs,
+                                   uint8_t *  pubInitialCall,
+                                   uint32_t   ulChannelCount)
+    : m_pfPreviousValues(pfPreviousValues),
+      m_pulPreviousTimestampsUs(pulPreviousTimestampsUs),
+      m_pubInitialCall(pubInitialCall),
+      m_ulChannelCount(ulChannelCount),
+      m_ulPendingInitialCount(0)
+{
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateOfChangeBank::CalcRateOfChangeUs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateOfChangeBank::CalcRateOfChangeUs(const float * pfCurrentValues, const uint32_t * pulCurrentTimestampsUs,
+                                          float * pfRates)
+{
+    Kernel::CalcRatesUs(pfCurrentValues, m_pfPreviousValues, pulCurrentTimestampsUs, m_pulPreviousTimestampsUs,
+                        pfRates, m_ulChannelCount);
+
+    //
+    // Channels on their initial call have no previous sample, so their rate is forced to 0 in the same way as the
+    // per-object path.  Once every channel has seen a sample this pass is skipped entirely.
+    //
+    if (m_ulPendingInitialCount != 0)
+    {
+        for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+        {
+            if (m_pubInitialCall[ulChannel] != 0)
+            {
+                m_pubInitialCall[ulChannel] = 0;
+                pfRates[ulChannel] = 0.0f;
+            }
+        }
+
+        m_ulPendingInitialCount = 0;
+    }
+
+    //
+    // Now the previous timestamp and values are the current values upon input since the calculation is complete.
+    //
+    memcpy(m_pfPreviousValues, pfCurrentValues, m_ulChannelCount * sizeof(float));
+
+    memcpy(m_pulPreviousTimestampsUs, pulCurrentTimestampsUs, m_ulChannelCount * sizeof(uint32_t));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateOfChangeBank::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateOfChangeBank::Reset(void)
+{
+    memset(m_pfPreviousValues, 0, m_ulChannelCount * sizeof(float));
+
+    memset(m_pulPreviousTimestampsUs, 0, m_ulChannelCount * sizeof(uint32_t));
+
+    memset(m_pubInitialCall, 1, m_ulChannelCount * sizeof(uint8_t));
+
+    m_ulPendingInitialCount = m_ulChannelCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateOfChangeBank::ResetChannel
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void RateOfChangeBank::ResetChannel(uint32_t ulChannel)
+{
+    if ((ulChannel < m_ulChannelCount) && (m_pubInitialCall[ulChannel] == 0))
+    {
+        m_pfPreviousValues[ulChannel] = 0.0f;
+        m_pulPreviousTimestampsUs[ulChannel] = 0;
+        m_pubInitialCall[ulChannel] = 1;
+
+        ++m_ulPendingInitialCount;
+    }
+}
+
+//**********************************************************************************************************************
+// Private methods
+//**********************************************************************************************************************
+// (none)
+
+} // SignalChain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateOfChangeBank.hpp
+///
+/// For computing rates of change of many channels at once
+///
+/// @par Full Description
+/// Class header for the RateOfChangeBank class and its statically sized StaticRateOfChangeBank storage.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(RATE_OF_CHANGE_BANK_HPP)
+#define RATE_OF_CHANGE_BANK_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: RateOfChangeBank
+    ///
+    /// For calculating the rates of change of a bank of channels in one call per scan
+    ///
+    /// @par Full Description
+    /// Equivalent to one RateOfChange object per channel, but the previous values, previous timestamps and initial
+    /// call flags of all channels are kept in separate contiguous arrays.  A scan of every channel is a single call
+    /// that runs the vectorized rate of change kernel over the arrays.  The results are identical to calling
+    /// RateOfChange::CalcRateOfChangeUs on each channel in turn.
+    ///
+    /// The bank does not own its storage.  Use StaticRateOfChangeBank to get a bank with its arrays embedded, or
+    /// supply arrays of at least ulChannelCount elements to the constructor.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class RateOfChangeBank
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChangeBank::RateOfChangeBank
+        ///
+        /// Constructor
+        ///
+        /// @param  [in]  pfPreviousValues          Storage for the previous value of each channel.
+        /// @param  [in]  pulPreviousTimestampsUs   Storage for the previous timestamp of each channel.
+        /// @param  [in]  pubInitialCall            Storage for the initial call flag of each channel.
+        /// @param  [in]  ulChannelCount            Number of channels in the bank.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RateOfChangeBank(float *    pfPreviousValues,
+                         uint32_t * pulPreviousTimestampsUs,
+                         uint8_t *  pubInitialCall,
+                         uint32_t   ulChannelCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChangeBank::~RateOfChangeBank
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~RateOfChangeBank() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChangeBank::CalcRateOfChangeUs
+        ///
+        /// Calculate the rate of change of every channel in units per microsecond.
+        ///
+        /// @par Full Description
+        /// Processes one scan of the bank.  Element i of each array belongs to channel i.  A channel's first call
+        /// after construction or reset returns 0, the same as RateOfChange::CalcRateOfChangeUs.
+        ///
+        /// @pre    All arrays hold GetChannelCount() elements and pfRates does not overlap the inputs.
+        /// @post   Rate of change of every channel calculated and the current samples stored as the previous ones.
+        ///
+        /// @param  [in]  pfCurrentValues          Current value of each channel.
+        /// @param  [in]  pulCurrentTimestampsUs   Current timestamp of each channel in microseconds.
+        /// @param  [out] pfRates                  Calculated rate of change of each channel in units per microsecond.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CalcRateOfChangeUs(const float * pfCurrentValues, const uint32_t * pulCurrentTimestampsUs, float * pfRates);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChangeBank::Reset
+        ///
+        /// Return every channel to its initial call state.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChangeBank::ResetChannel
+        ///
+        /// Return a single channel to its initial call state.
+        ///
+        /// @param  [in]  ulChannel   Channel to reset.  Out of range channels are ignored.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void ResetChannel(uint32_t ulChannel);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateOfChangeBank::GetChannelCount
+        ///
+        /// @return Number of channels in the bank
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetChannelCount(void) const { return m_ulChannelCount; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // (none)
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        // Inhibit copy constructor and assignment operator, the storage pointers must not be shared
+        RateOfChangeBank(RateOfChangeBank &);
+
+        RateOfChangeBank & operator=(RateOfChangeBank const&);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Previous value of each channel
+        float *    m_pfPreviousValues;
+
+        // Previous timestamp of each channel
+        uint32_t * m_pulPreviousTimestampsUs;
+
+        // Initial call flag of each channel
+        uint8_t *  m_pubInitialCall;
+
+        // Number of channels
+        uint32_t   m_ulChannelCount;
+
+        // Number of channels whose initial call flag is set, lets a steady state scan skip the flag pass
+        uint32_t   m_ulPendingInitialCount;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticRateOfChangeBankStorage
+    ///
+    /// Arrays backing a StaticRateOfChangeBank.  A separate base class so the arrays exist before the
+    /// RateOfChangeBank constructor resets them.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticRateOfChangeBankStorage
+{
+    protected:
+        // Previous value of each channel
+        alignas(32) float    m_afPreviousValues[CHANNEL_COUNT];
+
+        // Previous timestamp of each channel
+        alignas(32) uint32_t m_aulPreviousTimestampsUs[CHANNEL_COUNT];
+
+        // Initial call flag of each channel
+        uint8_t              m_aubInitialCall[CHANNEL_COUNT];
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticRateOfChangeBank
+    ///
+    /// RateOfChangeBank with embedded storage for CHANNEL_COUNT channels
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticRateOfChangeBank : private StaticRateOfChangeBankStorage<CHANNEL_COUNT>, public RateOfChangeBank
+{
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: StaticRateOfChangeBank::StaticRateOfChangeBank
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        StaticRateOfChangeBank()
+            : RateOfChangeBank(this->m_afPreviousValues,
+                               this->m_aulPreviousTimestampsUs,
+                               this->m_aubInitialCall,
+                               CHANNEL_COUNT)
+        {
+        }
+};
+} // SignalChain
+#endif // #if !defined(RATE_OF_CHANGE_BANK_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateOfChangeKernel.cpp
+///
+/// Implementation of the vectorized rate of change kernels
+///
+/// @see RateOfChangeKernel.hpp for a detailed description of these kernels.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added CalcFixedPeriodRatesUs
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "RateOfChangeKernel.hpp"
+#include "FloatLib.hpp"
+
+namespace SignalChain
+{
+namespace Kernel
+{
+
+// FORWARD REFERENCES
+// (none)
+
+#if defined(__AVX2__)
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// ConvertU32ToFloat
+///
+/// AVX2 only has a signed conversion.  Splitting the input into two 16 bit halves keeps both conversions and the
+/// scaling exact, so the single rounding in the final add matches a scalar static_cast<float>(uint32_t).
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline __m256 ConvertU32ToFloat(__m256i vInput)
+{
+    const __m256i vLowMask = _mm256_set1_epi32(0xFFFF);
+    const __m256  vHighScale = _mm256_set1_ps(65536.0f);
+
+    __m256 vHigh = _mm256_cvtepi32_ps(_mm256_srli_epi32(vInput, 16));
+    __m256 vLow  = _mm256_cvtepi32_ps(_mm256_and_si256(vInput, vLowMask));
+
+    return _mm256_add_ps(_mm256_mul_ps(vHigh, vHighScale), vLow);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CalcExactRateUs
+///
+/// The scalar rate of CalcRatesUs for one pair of samples.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline float CalcExactRateUs(float fCurrentValue, float fPreviousValue, uint32_t ulDifference)
+{
+    float fRateOfChange = (fCurrentValue - fPreviousValue) / static_cast<float>(ulDifference);
+
+    return (ulDifference != 0) ? fRateOfChange : App::FLOAT_INFINITY;
+}
+
+//**********************************************************************************************************************
+// Public methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Kernel::CalcRatesUs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void CalcRatesUs(const float *    pfCurrentValues,
+                 const float *    pfPreviousValues,
+                 const uint32_t * pulCurrentTimestampsUs,
+                 const uint32_t * pulPreviousTimestampsUs,
+                 float *          pfRates,
+                 uint32_t         ulCount)
+{
+    uint32_t ulIndex = 0;
+
+#if defined(__AVX2__)
+    const __m256  vInfinity = _mm256_set1_ps(App::FLOAT_INFINITY);
+    const __m256i vZero     = _mm256_setzero_si256();
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        __m256  vCurrent  = _mm256_loadu_ps(pfCurrentValues + ulIndex);
+        __m256  vPrevious = _mm256_loadu_ps(pfPreviousValues + ulIndex);
+        __m256i vCurrentTs  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pulCurrentTimestampsUs + ulIndex));
+        __m256i vPreviousTs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pulPreviousTimestampsUs + ulIndex));
+
+        // Modulo 2^32 subtraction handles a timestamp overflow between the two samples
+        __m256i vDifference = _mm256_sub_epi32(vCurrentTs, vPreviousTs);
+
+        __m256 vRate = _mm256_div_ps(_mm256_sub_ps(vCurrent, vPrevious), ConvertU32ToFloat(vDifference));
+
+        // Lanes with equal timestamps report infinity in place of the divide by zero result
+        __m256 vZeroDifference = _mm256_castsi256_ps(_mm256_cmpeq_epi32(vDifference, vZero));
+
+        _mm256_storeu_ps(pfRates + ulIndex, _mm256_blendv_ps(vRate, vInfinity, vZeroDifference));
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    const float32x4_t vInfinity = vdupq_n_f32(App::FLOAT_INFINITY);
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        float32x4_t vCurrent  = vld1q_f32(pfCurrentValues + ulIndex);
+        float32x4_t vPrevious = vld1q_f32(pfPreviousValues + ulIndex);
+        uint32x4_t  vDifference = vsubq_u32(vld1q_u32(pulCurrentTimestampsUs + ulIndex),
+                                            vld1q_u32(pulPreviousTimestampsUs + ulIndex));
+
+        float32x4_t vRate = vdivq_f32(vsubq_f32(vCurrent, vPrevious), vcvtq_f32_u32(vDifference));
+
+        vst1q_f32(pfRates + ulIndex, vbslq_f32(vceqzq_u32(vDifference), vInfinity, vRate));
+    }
+#endif
+
+    //
+    // Scalar fallback and vector tail.  Written without branches so that compilers without the intrinsic paths above
+    // are still free to auto-vectorize it.
+    //
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        pfRates[ulIndex] = CalcExactRateUs(pfCurrentValues[ulIndex], pfPreviousValues[ulIndex],
+                                           pulCurrentTimestampsUs[ulIndex] - pulPreviousTimestampsUs[ulIndex]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Kernel::CalcFixedPeriodRatesUs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t CalcFixedPeriodRatesUs(const float *    pfCurrentValues,
+                                const float *    pfPreviousValues,
+                                const uint32_t * pulCurrentTimestampsUs,
+                                const uint32_t * pulPreviousTimestampsUs,
+                                uint32_t         ulPeriodUs,
+                                uint32_t         ulToleranceUs,
+                                float            fInversePeriodUs,
+                                float *          pfRates,
+                                uint32_t         ulCount)
+{
+    // An elapsed time is within tolerance when its unsigned offset from the shortest accepted one is at most the span
+    const uint32_t ulShortestUs = ulPeriodUs - ulToleranceUs;
+    const uint32_t ulSpanUs = 2u * ulToleranceUs;
+
+    uint32_t ulOffPeriod = 0;
+    uint32_t ulIndex = 0;
+
+#if defined(__AVX2__)
+    const __m256i vShortest = _mm256_set1_epi32(static_cast<int32_t>(ulShortestUs));
+    const __m256i vSpan     = _mm256_set1_epi32(static_cast<int32_t>(ulSpanUs));
+    const __m256  vInverse  = _mm256_set1_ps(fInversePeriodUs);
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        __m256i vCurrentTs  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pulCurrentTimestampsUs + ulIndex));
+        __m256i vPreviousTs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pulPreviousTimestampsUs + ulIndex));
+        __m256i vOffset = _mm256_sub_epi32(_mm256_sub_epi32(vCurrentTs, vPreviousTs), vShortest);
+
+        _mm256_storeu_ps(pfRates + ulIndex, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(pfCurrentValues + ulIndex),
+                                                                        _mm256_loadu_ps(pfPreviousValues + ulIndex)),
+                                                          vInverse));
+
+        // Unsigned offset <= span through an unsigned min, the lanes failing it are recalculated exactly
+        __m256i vOnPeriod = _mm256_cmpeq_epi32(_mm256_min_epu32(vOffset, vSpan), vOffset);
+        uint32_t ulOffLanes = static_cast<uint32_t>(~_mm256_movemask_ps(_mm256_castsi256_ps(vOnPeriod))) & 0xFFu;
+
+        while (ulOffLanes != 0u)
+        {
+            uint32_t ulLane = ulIndex + static_cast<uint32_t>(__builtin_ctz(ulOffLanes));
+
+            ulOffLanes &= ulOffLanes - 1u;
+
+            pfRates[ulLane] = CalcExactRateUs(pfCurrentValues[ulLane], pfPreviousValues[ulLane],
+                                              pulCurrentTimestampsUs[ulLane] - pulPreviousTimestampsUs[ulLane]);
+            ++ulOffPeriod;
+        }
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    const uint32x4_t vShortest = vdupq_n_u32(ulShortestUs);
+    const uint32x4_t vSpan     = vdupq_n_u32(ulSpanUs);
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        uint32x4_t vOffset = vsubq_u32(vsubq_u32(vld1q_u32(pulCurrentTimestampsUs + ulIndex),
+                                                 vld1q_u32(pulPreviousTimestampsUs + ulIndex)),
+                                       vShortest);
+
+        vst1q_f32(pfRates + ulIndex, vmulq_n_f32(vsubq_f32(vld1q_f32(pfCurrentValues + ulIndex),
+                                                           vld1q_f32(pfPreviousValues + ulIndex)),
+                                                 fInversePeriodUs));
+
+        if (vminvq_u32(vcleq_u32(vOffset, vSpan)) == 0u)
+        {
+            for (uint32_t ulLane = ulIndex; ulLane < (ulIndex + 4); ++ulLane)
+            {
+                uint32_t ulDifference = pulCurrentTimestampsUs[ulLane] - pulPreviousTimestampsUs[ulLane];
+
+                if ((ulDifference - ulShortestUs) > ulSpanUs)
+                {
+                    pfRates[ulLane] = CalcExactRateUs(pfCurrentValues[ulLane], pfPreviousValues[ulLane],
+                                                      ulDifference);
+                    ++ulOffPeriod;
+                }
+            }
+        }
+    }
+#endif
+
+    //
+    // Scalar fallback and vector tail.
+    //
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        uint32_t ulDifference = pulCurrentTimestampsUs[ulIndex] - pulPreviousTimestampsUs[ulIndex];
+
+        if ((ulDifference - ulShortestUs) <= ulSpanUs)
+        {
+            pfRates[ulIndex] = (pfCurrentValues[ulIndex] - pfPreviousValues[ulIndex]) * fInversePeriodUs;
+        }
+        else
+        {
+            pfRates[ulIndex] = CalcExactRateUs(pfCurrentValues[ulIndex], pfPreviousValues[ulIndex], ulDifference);
+            ++ulOffPeriod;
+        }
+    }
+
+    return ulOffPeriod;
+}
+
+} // Kernel
+} // SignalChain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
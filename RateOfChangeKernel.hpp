@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file RateOfChangeKernel.hpp
+///
+/// Vectorized rate of change kernels
+///
+/// @par Full Description
+/// Array kernels shared by the multi-channel and batch rate of change paths.  The kernels are compiled for AVX2 or
+/// NEON when the target supports them and fall back to a portable scalar loop otherwise.  Every path produces
+/// results that are bit-identical to RateOfChange::CalcRateOfChangeUs for the same pair of samples.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added CalcFixedPeriodRatesUs
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(RATE_OF_CHANGE_KERNEL_HPP)
+#define RATE_OF_CHANGE_KERNEL_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+namespace Kernel
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: Kernel::CalcRatesUs
+    ///
+    /// Calculate element-wise rates of change in units per microsecond.
+    ///
+    /// @par Full Description
+    /// For every element i computes (pfCurrentValues[i] - pfPreviousValues[i]) divided by the elapsed time between
+    /// pulPreviousTimestampsUs[i] and pulCurrentTimestampsUs[i].  A 32 bit timestamp overflow is handled by modulo
+    /// arithmetic and an elapsed time of zero yields App::FLOAT_INFINITY, exactly as the per-object path does.  No
+    /// per-element branches are taken.
+    ///
+    /// @pre    pfRates does not overlap any of the input arrays.
+    /// @post   ulCount rates written to pfRates.
+    ///
+    /// @param  [in]  pfCurrentValues          Current values.
+    /// @param  [in]  pfPreviousValues         Previous values.
+    /// @param  [in]  pulCurrentTimestampsUs   Current timestamps in microseconds.
+    /// @param  [in]  pulPreviousTimestampsUs  Previous timestamps in microseconds.
+    /// @param  [out] pfRates                  Calculated rates of change in units per microsecond.
+    /// @param  [in]  ulCount                  Number of elements.
+    ///
+    /// @return none
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void CalcRatesUs(const float *    pfCurrentValues,
+                     const float *    pfPreviousValues,
+                     const uint32_t * pulCurrentTimestampsUs,
+                     const uint32_t * pulPreviousTimestampsUs,
+                     float *          pfRates,
+                     uint32_t         ulCount);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: Kernel::CalcFixedPeriodRatesUs
+    ///
+    /// Calculate element-wise rates of change in units per microsecond for samples taken on a fixed period.
+    ///
+    /// @par Full Description
+    /// Every element whose elapsed time is within ulToleranceUs of ulPeriodUs is taken to be exactly one period
+    /// apart, and its rate is the change in value multiplied by fInversePeriodUs, with no division.  Any other
+    /// element, including equal timestamps, goes through the exact calculation of CalcRatesUs and is counted.
+    /// The vector paths multiply whole vectors and only revisit the lanes out of tolerance.
+    ///
+    /// @pre    pfRates does not overlap any of the input arrays, ulToleranceUs is less than ulPeriodUs and at most
+    ///         0x7FFFFFFF.
+    /// @post   ulCount rates written to pfRates.
+    ///
+    /// @param  [in]  pfCurrentValues          Current values.
+    /// @param  [in]  pfPreviousValues         Previous values.
+    /// @param  [in]  pulCurrentTimestampsUs   Current timestamps in microseconds.
+    /// @param  [in]  pulPreviousTimestampsUs  Previous timestamps in microseconds.
+    /// @param  [in]  ulPeriodUs               Nominal sample period in microseconds.
+    /// @param  [in]  ulToleranceUs            Largest difference from the period still taken as the period.
+    /// @param  [in]  fInversePeriodUs         1 / ulPeriodUs.
+    /// @param  [out] pfRates                  Calculated rates of change in units per microsecond.
+    /// @param  [in]  ulCount                  Number of elements.
+    ///
+    /// @return number of elements out of tolerance
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t CalcFixedPeriodRatesUs(const float *    pfCurrentValues,
+                                    const float *    pfPreviousValues,
+                                    const uint32_t * pulCurrentTimestampsUs,
+                                    const uint32_t * pulPreviousTimestampsUs,
+                                    uint32_t         ulPeriodUs,
+                                    uint32_t         ulToleranceUs,
+                                    float            fInversePeriodUs,
+                                    float *          pfRates,
+                                    uint32_t         ulCount);
+
+} // Kernel
+} // SignalChain
+#endif // #if !defined(RATE_OF_CHANGE_KERNEL_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file SampleRing.hpp
+///
+/// For handing samples from an acquisition context to the signal chain
+///
+/// @par Full Description
+/// Class header and implementation of the SampleRing class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Explained why the ring keeps to atomic loads and stores
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(SAMPLE_RING_HPP)
+#define SAMPLE_RING_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "RateOfChange.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: SampleRing
+    ///
+    /// Lock free single producer, single consumer ring of (value, timestamp) samples
+    ///
+    /// @par Full Description
+    /// The producer is the ADC completion context, an ISR on target or a real time thread on Linux, and calls Push.
+    /// The consumer is the thread running the signal chain and calls Drain or Pop.  Neither side ever blocks or
+    /// allocates.  When the ring is full Push drops the sample and counts an overrun rather than waiting.
+    ///
+    /// Values and timestamps are stored in separate arrays so a drained run of samples is already in the layout the
+    /// batch RateOfChange::CalcRateOfChangeUs takes, with no copy.  The producer and consumer indexes sit on their
+    /// own cache lines, and each side keeps a private copy of the other side's index that it only refreshes when the
+    /// ring looks full or empty, so in steady state the two sides do not share any cache line they write.
+    ///
+    /// Only atomic loads and stores are used, no read-modify-write.  Those are plain 32 bit accesses on the Cortex-M4
+    /// and on the Cortex-M0+ of the S124 alike, but the M0+ has no exclusive access instructions, so an atomic
+    /// read-modify-write there is a library call that masks interrupts.  Keeping to loads and stores keeps the ring
+    /// lock free on both.  The price is one writer per index.  The watchdog instrumentation in CpfBsp keeps to the
+    /// same rule for the same reason.
+    ///
+    /// CAPACITY must be a power of two.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CAPACITY>
+class SampleRing
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+        // (none)
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::SampleRing
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SampleRing() : m_ulHead(0), m_ulCachedTail(0), m_ulOverrunCount(0), m_ulTail(0), m_ulCachedHead(0) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::~SampleRing
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~SampleRing() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::Push
+        ///
+        /// Add a sample to the ring.  Producer side only.
+        ///
+        /// @pre    Called from the single producer context.
+        /// @post   Sample stored, or the overrun count incremented when the ring is full.
+        ///
+        /// @param  [in]  fValue          Sample value.
+        /// @param  [in]  ulTimestampUs   Sample timestamp in microseconds.
+        ///
+        /// @return whether the sample was stored
+        /// @retval true:  the sample was stored
+        /// @retval false: the ring was full and the sample was dropped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Push(float fValue, uint32_t ulTimestampUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::Drain
+        ///
+        /// Remove up to ulMaxCount samples and calculate their rates of change.  Consumer side only.
+        ///
+        /// @par Full Description
+        /// The samples are passed straight from the ring storage to the batch RateOfChange::CalcRateOfChangeUs, in at
+        /// most two runs when the samples wrap around the end of the ring.
+        ///
+        /// @pre    Called from the single consumer context.
+        /// @post   Samples removed from the ring and their rates written to pfRates.
+        ///
+        /// @param  [in]  rRateOfChange   Rate of change state of the channel the ring feeds.
+        /// @param  [out] pfRates         Rate of change of each sample removed, in units per microsecond.
+        /// @param  [in]  ulMaxCount      Capacity of pfRates.
+        ///
+        /// @return Number of samples removed
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t Drain(RateOfChange & rRateOfChange, float * pfRates, uint32_t ulMaxCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::Pop
+        ///
+        /// Remove up to ulMaxCount samples into caller buffers.  Consumer side only.
+        ///
+        /// @pre    Called from the single consumer context.
+        /// @post   Samples removed from the ring.
+        ///
+        /// @param  [out] pfValues          Values of the samples removed.
+        /// @param  [out] pulTimestampsUs   Timestamps of the samples removed.
+        /// @param  [in]  ulMaxCount        Capacity of the buffers.
+        ///
+        /// @return Number of samples removed
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t Pop(float * pfValues, uint32_t * pulTimestampsUs, uint32_t ulMaxCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::GetOverrunCount
+        ///
+        /// @return Number of samples dropped because the ring was full
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetOverrunCount(void) const { return m_ulOverrunCount.load(std::memory_order_relaxed); }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        static_assert((CAPACITY != 0) && ((CAPACITY & (CAPACITY - 1)) == 0), "Ring capacity must be a power of two");
+        static_assert(CAPACITY <= 0x80000000U, "Ring capacity must fit the free running indexes");
+
+        // Size of the cache line the indexes are padded to
+        static const uint32_t CACHE_LINE_SIZE = 64;
+
+        // Mask from a free running index to a slot
+        static const uint32_t INDEX_MASK = CAPACITY - 1;
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleRing::Acquire
+        ///
+        /// @return Number of samples, at most ulMaxCount, the consumer may remove starting at m_ulTail
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t Acquire(uint32_t ulMaxCount);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Producer side: free running index of the next slot to write, and the producer's copy of the tail
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_ulHead;
+        uint32_t                                       m_ulCachedTail;
+
+        // Samples dropped because the ring was full, written by the producer only
+        std::atomic<uint32_t>                          m_ulOverrunCount;
+
+        // Consumer side: free running index of the next slot to read, and the consumer's copy of the head
+        alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_ulTail;
+        uint32_t                                       m_ulCachedHead;
+
+        // Sample storage
+        alignas(CACHE_LINE_SIZE) float                 m_afValues[CAPACITY];
+        uint32_t                                       m_aulTimestampsUs[CAPACITY];
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleRing::Push
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t CAPACITY>
+bool SampleRing<CAPACITY>::Push(float fValue, uint32_t ulTimestampUs)
+{
+    bool     bStored = false;
+    uint32_t ulHead = m_ulHead.load(std::memory_order_relaxed);
+
+    //
+    // Only look at the consumer's index when the ring appears full from the last time it was read.
+    //
+    if ((ulHead - m_ulCachedTail) == CAPACITY)
+    {
+        m_ulCachedTail = m_ulTail.load(std::memory_order_acquire);
+    }
+
+    if ((ulHead - m_ulCachedTail) != CAPACITY)
+    {
+        m_afValues[ulHead & INDEX_MASK] = fValue;
+        m_aulTimestampsUs[ulHead & INDEX_MASK] = ulTimestampUs;
+
+        // Release publishes the sample before the consumer can see the new head
+        m_ulHead.store(ulHead + 1, std::memory_order_release);
+
+        bStored = true;
+    }
+    else
+    {
+        // The producer is the only writer so a load and store is enough
+        m_ulOverrunCount.store(m_ulOverrunCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    return bStored;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleRing::Drain
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t CAPACITY>
+uint32_t SampleRing<CAPACITY>::Drain(RateOfChange & rRateOfChange, float * pfRates, uint32_t ulMaxCount)
+{
+    uint32_t ulTail = m_ulTail.load(std::memory_order_relaxed);
+    uint32_t ulCount = Acquire(ulMaxCount);
+    uint32_t ulSlot = ulTail & INDEX_MASK;
+
+    // Samples up to the end of the storage, then any that wrapped around to the start
+    uint32_t ulFirstRun = ((CAPACITY - ulSlot) < ulCount) ? (CAPACITY - ulSlot) : ulCount;
+
+    rRateOfChange.CalcRateOfChangeUs(&m_afValues[ulSlot], &m_aulTimestampsUs[ulSlot], pfRates, ulFirstRun);
+
+    rRateOfChange.CalcRateOfChangeUs(&m_afValues[0], &m_aulTimestampsUs[0], &pfRates[ulFirstRun],
+                                     ulCount - ulFirstRun);
+
+    // Release hands the slots back to the producer only after they have been read
+    m_ulTail.store(ulTail + ulCount, std::memory_order_release);
+
+    return ulCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleRing::Pop
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t CAPACITY>
+uint32_t SampleRing<CAPACITY>::Pop(float * pfValues, uint32_t * pulTimestampsUs, uint32_t ulMaxCount)
+{
+    uint32_t ulTail = m_ulTail.load(std::memory_order_relaxed);
+    uint32_t ulCount = Acquire(ulMaxCount);
+
+    for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+    {
+        pfValues[ulIndex] = m_afValues[(ulTail + ulIndex) & INDEX_MASK];
+        pulTimestampsUs[ulIndex] = m_aulTimestampsUs[(ulTail + ulIndex) & INDEX_MASK];
+    }
+
+    m_ulTail.store(ulTail + ulCount, std::memory_order_release);
+
+    return ulCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleRing::Acquire
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t CAPACITY>
+uint32_t SampleRing<CAPACITY>::Acquire(uint32_t ulMaxCount)
+{
+    uint32_t ulTail = m_ulTail.load(std::memory_order_relaxed);
+
+    //
+    // Only look at the producer's index when fewer samples than requested are known to be available.
+    //
+    if ((m_ulCachedHead - ulTail) < ulMaxCount)
+    {
+        // Acquire makes the samples published by the producer visible
+        m_ulCachedHead = m_ulHead.load(std::memory_order_acquire);
+    }
+
+    uint32_t ulAvailable = m_ulCachedHead - ulTail;
+
+    return (ulAvailable < ulMaxCount) ? ulAvailable : ulMaxCount;
+}
+
+} // SignalChain
+#endif // #if !defined(SAMPLE_RING_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
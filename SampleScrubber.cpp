@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file SampleScrubber.cpp
+///
+/// Implementation of the SampleScrubber class
+///
+/// @see SampleScrubber.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 SCRUB_CLAMP also clamps finite samples outside the limits
+/// - agent 16-Oct-2026 Flushed subnormals are clamped with the other replacements, so they are counted once
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "SampleScrubber.hpp"
+#include "FloatLib.hpp"
+
+namespace SignalChain
+{
+
+// FORWARD REFERENCES
+// (none)
+
+//**********************************************************************************************************************
+// Public methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::SampleScrubber
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+SampleScrubber::SampleScrubber(ScrubChannel * pChannels, uint32_t ulChannelCount)
+    : m_pChannels(pChannels),
+      m_ulChannelCount(ulChannelCount)
+{
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        m_pChannels[ulChannel].fLowLimit = 0.0f;
+        m_pChannels[ulChannel].fHighLimit = 0.0f;
+        m_pChannels[ulChannel].ubPolicy = SCRUB_HOLD_LAST_GOOD;
+        m_pChannels[ulChannel].bFlushSubnormals = false;
+    }
+
+    Reset();
+
+    ClearCounters();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::SetPolicy
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+bool SampleScrubber::SetPolicy(uint32_t ulChannel, ScrubPolicy ePolicy, float fLowLimit, float fHighLimit,
+                               bool bFlushSubnormals)
+{
+    bool bValid = (ulChannel < m_ulChannelCount) &&
+                  ((ePolicy == SCRUB_HOLD_LAST_GOOD) || (ePolicy == SCRUB_CLAMP) || (ePolicy == SCRUB_ZERO)) &&
+                  App::IsFinite(fLowLimit) && App::IsFinite(fHighLimit) && (fLowLimit <= fHighLimit);
+
+    if (bValid)
+    {
+        ScrubChannel & rChannel = m_pChannels[ulChannel];
+
+        rChannel.fLowLimit = fLowLimit;
+        rChannel.fHighLimit = fHighLimit;
+        rChannel.ubPolicy = static_cast<uint8_t>(ePolicy);
+        rChannel.bFlushSubnormals = bFlushSubnormals;
+    }
+
+    return bValid;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::Scrub
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t SampleScrubber::Scrub(uint32_t ulChannel, float * pfSamples, uint32_t ulCount)
+{
+    ScrubChannel & rChannel = m_pChannels[ulChannel];
+    uint32_t ulTypeMask = App::FLP_MASK_NAN | App::FLP_MASK_INFINITE |
+                          (rChannel.bFlushSubnormals ? App::FLP_MASK_SUBNORMAL : 0u);
+    uint32_t ulReplaced = 0;
+    uint32_t ulIndex = 0;
+    bool     bDone = false;
+
+    //
+    // Skip to each sample to replace with the vectorized search.  The sample before it, when the search moved at
+    // all, is a good one and the last good sample so far.
+    //
+    while (!bDone)
+    {
+        uint32_t ulFound = ulIndex + App::FpFindFirst(pfSamples + ulIndex, ulCount - ulIndex, ulTypeMask);
+
+        if (ulFound != ulIndex)
+        {
+            rChannel.fLastGood = pfSamples[ulFound - 1u];
+        }
+
+        if (ulFound == ulCount)
+        {
+            bDone = true;
+        }
+        else
+        {
+            ScrubSample(rChannel, pfSamples[ulFound]);
+
+            ++ulReplaced;
+            ulIndex = ulFound + 1u;
+        }
+    }
+
+    //
+    // The buffer is now free of NaN, so clamping is a min and max pass.  The replacements are already within the
+    // limits, so the samples it counts are the finite ones that were outside them.
+    //
+    if (rChannel.ubPolicy == SCRUB_CLAMP)
+    {
+        uint32_t ulClamped = ClampSamples(pfSamples, ulCount, rChannel.fLowLimit, rChannel.fHighLimit);
+
+        ClampSamples(&rChannel.fLastGood, 1u, rChannel.fLowLimit, rChannel.fHighLimit);
+
+        rChannel.ulClampedCount = ((UINT32_MAX - rChannel.ulClampedCount) < ulClamped) ? UINT32_MAX :
+                                  (rChannel.ulClampedCount + ulClamped);
+        ulReplaced += ulClamped;
+    }
+
+    return ulReplaced;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::Reset
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void SampleScrubber::Reset(void)
+{
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        m_pChannels[ulChannel].fLastGood = 0.0f;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::ClearCounters
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void SampleScrubber::ClearCounters(void)
+{
+    for (uint32_t ulChannel = 0; ulChannel < m_ulChannelCount; ++ulChannel)
+    {
+        m_pChannels[ulChannel].ulNanCount = 0;
+        m_pChannels[ulChannel].ulInfiniteCount = 0;
+        m_pChannels[ulChannel].ulSubnormalCount = 0;
+        m_pChannels[ulChannel].ulClampedCount = 0;
+    }
+}
+
+//**********************************************************************************************************************
+// Private methods
+//**********************************************************************************************************************
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::ScrubSample
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void SampleScrubber::ScrubSample(ScrubChannel & rChannel, float & rfSample)
+{
+    float fSample = rfSample;
+    uint32_t * pulCounter = &rChannel.ulSubnormalCount;
+
+    if (App::IsNan(fSample))
+    {
+        pulCounter = &rChannel.ulNanCount;
+        fSample = (rChannel.ubPolicy == SCRUB_ZERO) ? 0.0f : rChannel.fLastGood;
+    }
+    else if (App::IsInf(fSample))
+    {
+        pulCounter = &rChannel.ulInfiniteCount;
+
+        if (rChannel.ubPolicy == SCRUB_CLAMP)
+        {
+            fSample = (fSample > 0.0f) ? rChannel.fHighLimit : rChannel.fLowLimit;
+        }
+        else
+        {
+            fSample = (rChannel.ubPolicy == SCRUB_ZERO) ? 0.0f : rChannel.fLastGood;
+        }
+    }
+    else
+    {
+        // Subnormal, keep only the sign so the flushed sample is the zero an FTZ unit would have produced
+        fSample = (fSample < 0.0f) ? -0.0f : 0.0f;
+    }
+
+    // Clamped here so the clamp pass only counts the finite samples that were outside the limits
+    if (rChannel.ubPolicy == SCRUB_CLAMP)
+    {
+        ClampSamples(&fSample, 1u, rChannel.fLowLimit, rChannel.fHighLimit);
+    }
+
+    if (pulCounter == &rChannel.ulSubnormalCount)
+    {
+        rChannel.fLastGood = fSample;
+    }
+
+    *pulCounter += (*pulCounter != UINT32_MAX) ? 1u : 0u;
+
+    rfSample = fSample;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SampleScrubber::ClampSamples
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+uint32_t SampleScrubber::ClampSamples(float * pfSamples, uint32_t ulCount, float fLowLimit, float fHighLimit)
+{
+    uint32_t ulClamped = 0;
+    uint32_t ulIndex = 0;
+
+#if defined(__AVX2__)
+    const __m256 vLow = _mm256_set1_ps(fLowLimit);
+    const __m256 vHigh = _mm256_set1_ps(fHighLimit);
+
+    for (; (ulIndex + 8) <= ulCount; ulIndex += 8)
+    {
+        __m256 vSamples = _mm256_loadu_ps(pfSamples + ulIndex);
+        __m256 vOutside = _mm256_or_ps(_mm256_cmp_ps(vSamples, vLow, _CMP_LT_OQ),
+                                       _mm256_cmp_ps(vSamples, vHigh, _CMP_GT_OQ));
+
+        ulClamped += static_cast<uint32_t>(__builtin_popcount(_mm256_movemask_ps(vOutside)));
+
+        _mm256_storeu_ps(pfSamples + ulIndex, _mm256_min_ps(_mm256_max_ps(vSamples, vLow), vHigh));
+    }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    const float32x4_t vLow = vdupq_n_f32(fLowLimit);
+    const float32x4_t vHigh = vdupq_n_f32(fHighLimit);
+
+    for (; (ulIndex + 4) <= ulCount; ulIndex += 4)
+    {
+        float32x4_t vSamples = vld1q_f32(pfSamples + ulIndex);
+        uint32x4_t  vOutside = vorrq_u32(vcltq_f32(vSamples, vLow), vcgtq_f32(vSamples, vHigh));
+
+        // Each outside lane is all ones, so subtracting the sum counts them
+        ulClamped -= vaddvq_u32(vOutside);
+
+        vst1q_f32(pfSamples + ulIndex, vminq_f32(vmaxq_f32(vSamples, vLow), vHigh));
+    }
+#endif
+
+    //
+    // Scalar fallback and vector tail.
+    //
+    for (; ulIndex < ulCount; ++ulIndex)
+    {
+        float fSample = pfSamples[ulIndex];
+
+        if (fSample < fLowLimit)
+        {
+            pfSamples[ulIndex] = fLowLimit;
+            ++ulClamped;
+        }
+        else if (fSample > fHighLimit)
+        {
+            pfSamples[ulIndex] = fHighLimit;
+            ++ulClamped;
+        }
+    }
+
+    return ulClamped;
+}
+
+} // SignalChain
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,271 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file SampleScrubber.hpp
+///
+/// For replacing NaN, infinite and subnormal samples in buffers before they reach the signal chain
+///
+/// @par Full Description
+/// Class header for the SampleScrubber class and its statically sized StaticSampleScrubber storage.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 SCRUB_CLAMP also clamps finite samples outside the limits
+/// - agent 16-Oct-2026 Flushed subnormals are clamped with the other replacements, so they are counted once
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(SAMPLE_SCRUBBER_HPP)
+#define SAMPLE_SCRUBBER_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    // What a channel puts in place of a NaN or infinite sample
+    enum ScrubPolicy
+    {
+        SCRUB_HOLD_LAST_GOOD = 0,   ///< The last finite sample of the channel
+        SCRUB_CLAMP          = 1,   ///< Every sample clamped to the channel limits, NaN to the last finite sample
+        SCRUB_ZERO           = 2    ///< 0
+    };
+
+    // Configuration, state and fault counters of one channel of a SampleScrubber
+    struct ScrubChannel
+    {
+        float    fLowLimit;             ///< Lowest sample under SCRUB_CLAMP
+        float    fHighLimit;            ///< Highest sample under SCRUB_CLAMP
+        float    fLastGood;             ///< Last finite sample, clamped under SCRUB_CLAMP, 0 before the first
+        uint8_t  ubPolicy;              ///< ScrubPolicy
+        bool     bFlushSubnormals;      ///< Subnormal samples are replaced with zero of the same sign, clamped
+                                        ///< under SCRUB_CLAMP
+        uint32_t ulNanCount;            ///< NaN samples replaced
+        uint32_t ulInfiniteCount;       ///< Infinite samples replaced
+        uint32_t ulSubnormalCount;      ///< Subnormal samples flushed
+        uint32_t ulClampedCount;        ///< Normal and zero samples clamped to the limits under SCRUB_CLAMP
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: SampleScrubber
+    ///
+    /// For scrubbing buffers of samples of a bank of channels in place
+    ///
+    /// @par Full Description
+    /// A single NaN from a failed sensor becomes the previous value of a RateOfChange and spoils the rates until two
+    /// good samples have followed it.  Scrubbing each buffer before it is differentiated contains the fault: NaN and
+    /// infinite samples are replaced according to the policy of the channel and counted, and optionally subnormal
+    /// samples are flushed to zero so that the arithmetic after does not take the slow subnormal paths of x86 cores.
+    ///
+    /// A buffer is searched for the first sample to replace with App::FpFindFirst, which compares several samples at
+    /// a time with SIMD, so a clean buffer costs one vectorized pass with no stores.  Only the runs of bad samples
+    /// are visited one at a time.  The replacements are the same as those of SanitizeStage, which does the same job
+    /// sample by sample inside a SignalPipeline.
+    ///
+    /// Under SCRUB_CLAMP a second vectorized pass clamps the buffer to the channel limits with min and max, so an
+    /// out of range sample is clamped whether it is finite or infinite.  It is only made for channels with that
+    /// policy.
+    ///
+    /// Counters saturate rather than wrap, and are only cleared by ClearCounters.
+    ///
+    /// The scrubber does not own its storage.  Use StaticSampleScrubber to get a scrubber with its channels embedded,
+    /// or supply an array of at least ulChannelCount channels to the constructor.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SampleScrubber
+{
+    public:
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::SampleScrubber
+        ///
+        /// Constructor, every channel starts holding the last good sample, with no limits, no subnormal flush and
+        /// its counters cleared.
+        ///
+        /// @param  [in]  pChannels         Storage for the channels.
+        /// @param  [in]  ulChannelCount    Number of channels.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SampleScrubber(ScrubChannel * pChannels, uint32_t ulChannelCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::~SampleScrubber
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~SampleScrubber() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::SetPolicy
+        ///
+        /// Configure the replacements of one channel.  The last good sample and the counters are kept.
+        ///
+        /// @param  [in]  ulChannel         Channel to configure.
+        /// @param  [in]  ePolicy           Replacement of NaN and infinite samples.
+        /// @param  [in]  fLowLimit         Lowest sample under SCRUB_CLAMP, finite.
+        /// @param  [in]  fHighLimit        Highest sample under SCRUB_CLAMP, finite.
+        /// @param  [in]  bFlushSubnormals  Whether subnormal samples are flushed to zero.
+        ///
+        /// @return whether the configuration was accepted
+        /// @retval true:  configured
+        /// @retval false: channel out of range, unknown policy, a limit is not finite or fLowLimit > fHighLimit
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool SetPolicy(uint32_t ulChannel, ScrubPolicy ePolicy, float fLowLimit, float fHighLimit,
+                       bool bFlushSubnormals);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::Scrub
+        ///
+        /// Scrub a buffer of consecutive samples of one channel in place.
+        ///
+        /// @pre    ulChannel is less than GetChannelCount().
+        /// @post   pfSamples holds no NaN or infinity, nor subnormals if the channel flushes them, nor samples outside
+        ///         the limits under SCRUB_CLAMP.
+        ///
+        /// @param  [in]     ulChannel  Channel the samples belong to.
+        /// @param  [in,out] pfSamples  Samples, oldest first.
+        /// @param  [in]     ulCount    Number of samples.
+        ///
+        /// @return number of samples replaced or clamped
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t Scrub(uint32_t ulChannel, float * pfSamples, uint32_t ulCount);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::Reset
+        ///
+        /// Forget the last good sample of every channel, keeping the policies and counters.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::ClearCounters
+        ///
+        /// Clear the fault counters of every channel.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void ClearCounters(void);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::GetChannel
+        ///
+        /// @param  [in]  ulChannel   Channel, less than GetChannelCount().
+        ///
+        /// @return configuration, state and counters of the channel
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const ScrubChannel & GetChannel(uint32_t ulChannel) const { return m_pChannels[ulChannel]; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::GetChannelCount
+        ///
+        /// @return Number of channels
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetChannelCount(void) const { return m_ulChannelCount; }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // (none)
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::ScrubSample
+        ///
+        /// Replace one sample found by the search.
+        ///
+        /// @param  [in,out] rChannel   Channel the sample belongs to.
+        /// @param  [in,out] rfSample   NaN, infinite or subnormal sample.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void ScrubSample(ScrubChannel & rChannel, float & rfSample);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SampleScrubber::ClampSamples
+        ///
+        /// Clamp a buffer with no NaN to the limits in place.
+        ///
+        /// @param  [in,out] pfSamples  Samples.
+        /// @param  [in]     ulCount    Number of samples.
+        /// @param  [in]     fLowLimit  Lowest sample.
+        /// @param  [in]     fHighLimit Highest sample.
+        ///
+        /// @return number of samples that were outside the limits
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint32_t ClampSamples(float * pfSamples, uint32_t ulCount, float fLowLimit, float fHighLimit);
+
+        // Inhibit copy constructor and assignment operator, the storage pointer must not be shared
+        SampleScrubber(SampleScrubber &);
+
+        SampleScrubber & operator=(SampleScrubber const&);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Per channel configuration, state and counters
+        ScrubChannel * m_pChannels;
+
+        // Number of channels
+        uint32_t       m_ulChannelCount;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticSampleScrubberStorage
+    ///
+    /// Channels backing a StaticSampleScrubber.  A separate base class so the channels exist before the
+    /// SampleScrubber constructor initializes them.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticSampleScrubberStorage
+{
+    protected:
+        ScrubChannel m_aChannels[CHANNEL_COUNT];
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: StaticSampleScrubber
+    ///
+    /// SampleScrubber with embedded storage for CHANNEL_COUNT channels
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <uint32_t CHANNEL_COUNT>
+class StaticSampleScrubber : private StaticSampleScrubberStorage<CHANNEL_COUNT>, public SampleScrubber
+{
+    public:
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: StaticSampleScrubber::StaticSampleScrubber
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        StaticSampleScrubber()
+            : SampleScrubber(this->m_aChannels, CHANNEL_COUNT)
+        {
+        }
+};
+} // SignalChain
+#endif // #if !defined(SAMPLE_SCRUBBER_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
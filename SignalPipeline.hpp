@@ -0,0 +1,533 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file SignalPipeline.hpp
+///
+/// For composing signal chain stages into a single fused computation
+///
+/// @par Full Description
+/// Class header and implementation of the BasicSignalPipeline class template and the standard pipeline stages.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(SIGNAL_PIPELINE_HPP)
+#define SIGNAL_PIPELINE_HPP
+
+// SYSTEM INCLUDES
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "FloatLib.hpp"
+#include "RateOfChange.hpp"
+#include "TimeBase.hpp"
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // STRUCT NAME: PipelineSample
+    ///
+    /// Per sample context handed along a pipeline with the value
+    ///
+    /// @par Full Description
+    /// Carries the sample timestamp to every stage, and the elapsed time found by a rate stage on to the stages after
+    /// it, so that a second derivative does not keep a timestamp history of its own.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TimeBaseType>
+struct PipelineSample
+{
+    // Time base of the pipeline timestamps
+    typedef TimeBaseType            TimeBase;
+    typedef typename TimeBase::Tick Tick;
+
+    Tick  tTimestamp;       ///< Timestamp of the sample
+    float fElapsed;         ///< Time since the previous sample in the unit of the last rate stage
+    bool  bElapsedValid;    ///< The last rate stage had a previous sample, so fElapsed and its rate are real
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: SanitizeStage
+    ///
+    /// Replaces NaN and infinite values with the last finite value
+    ///
+    /// @par Full Description
+    /// Values before the first finite one come out as 0.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SanitizeStage
+{
+    public:
+        // Pipeline stage traits
+        static const bool PROVIDES_ELAPSED = false;
+        static const bool REQUIRES_ELAPSED = false;
+
+        SanitizeStage() : m_fLastFinite(0.0f) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SanitizeStage::Process
+        ///
+        /// @return fValue when finite, otherwise the last finite value
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Sample>
+        float Process(float fValue, Sample &)
+        {
+            m_fLastFinite = App::IsFinite(fValue) ? fValue : m_fLastFinite;
+
+            return m_fLastFinite;
+        }
+
+        void Reset(void) { m_fLastFinite = 0.0f; }
+
+    private:
+        // Last finite value seen
+        float m_fLastFinite;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: ScaleStage
+    ///
+    /// Converts raw values to engineering units by a gain and an offset
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ScaleStage
+{
+    public:
+        // Pipeline stage traits
+        static const bool PROVIDES_ELAPSED = false;
+        static const bool REQUIRES_ELAPSED = false;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ScaleStage::ScaleStage
+        ///
+        /// @param  [in]  fGain     Multiplier.
+        /// @param  [in]  fOffset   Added after the multiply.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit ScaleStage(float fGain = 1.0f, float fOffset = 0.0f) : m_fGain(fGain), m_fOffset(fOffset) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: ScaleStage::Process
+        ///
+        /// @return fValue * gain + offset
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Sample>
+        float Process(float fValue, Sample &) const { return (fValue * m_fGain) + m_fOffset; }
+
+        void Reset(void) {}
+
+        void SetScale(float fGain, float fOffset) { m_fGain = fGain; m_fOffset = fOffset; }
+
+    private:
+        float m_fGain;
+        float m_fOffset;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: RateStage
+    ///
+    /// Rate of change in units per RateUnit
+    ///
+    /// @par Full Description
+    /// Gives exactly the results of BasicRateOfChange::CalcRateOfChange<RateUnit> on the same time base: 0 on the
+    /// first sample, App::FLOAT_INFINITY for equal timestamps.  The elapsed time is also left in the sample for the
+    /// stages after it.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename RateUnit>
+class RateStage
+{
+    public:
+        // Pipeline stage traits
+        static const bool PROVIDES_ELAPSED = true;
+        static const bool REQUIRES_ELAPSED = false;
+
+        RateStage() : m_bInitialCall(true), m_fPreviousValue(0.0f), m_ullPreviousTimestamp(0) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: RateStage::Process
+        ///
+        /// @return rate of change in units per RateUnit
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Sample>
+        float Process(float fValue, Sample & rSample);
+
+        void Reset(void) { m_bInitialCall = true; m_fPreviousValue = 0.0f; m_ullPreviousTimestamp = 0; }
+
+    private:
+        bool     m_bInitialCall;
+        float    m_fPreviousValue;
+
+        // Wide enough for the tick type of any time base
+        uint64_t m_ullPreviousTimestamp;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: SecondDerivativeStage
+    ///
+    /// Rate of change of the rate produced by the rate stage before it
+    ///
+    /// @par Full Description
+    /// Differences successive rates over the elapsed time the rate stage left in the sample, so it keeps only the
+    /// previous rate.  Its unit is the value unit per RateUnit squared, RateUnit being that of the rate stage.  It
+    /// outputs 0 until the rate stage has produced two real rates, so the 0 a rate stage gives for its first sample
+    /// never shows up as a step.  A zero elapsed time gives App::FLOAT_INFINITY.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SecondDerivativeStage
+{
+    public:
+        // Pipeline stage traits
+        static const bool PROVIDES_ELAPSED = false;
+        static const bool REQUIRES_ELAPSED = true;
+
+        SecondDerivativeStage() : m_bHavePreviousRate(false), m_fPreviousRate(0.0f) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: SecondDerivativeStage::Process
+        ///
+        /// @return second derivative
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Sample>
+        float Process(float fRate, Sample & rSample)
+        {
+            float fSecondDerivative = 0.0f;
+
+            if (m_bHavePreviousRate && rSample.bElapsedValid)
+            {
+                fSecondDerivative = (rSample.fElapsed != 0.0f) ? ((fRate - m_fPreviousRate) / rSample.fElapsed) :
+                                                                 App::FLOAT_INFINITY;
+            }
+
+            m_bHavePreviousRate = rSample.bElapsedValid;
+            m_fPreviousRate = fRate;
+
+            return fSecondDerivative;
+        }
+
+        void Reset(void) { m_bHavePreviousRate = false; m_fPreviousRate = 0.0f; }
+
+    private:
+        bool  m_bHavePreviousRate;
+        float m_fPreviousRate;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: LowPassStage
+    ///
+    /// First order low pass filter, y += alpha * (x - y)
+    ///
+    /// @par Full Description
+    /// The first sample initializes the output.  Non-finite inputs, such as the infinity of a rate over equal
+    /// timestamps, are skipped and the previous output repeated, so one bad sample cannot poison the filter.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class LowPassStage
+{
+    public:
+        // Pipeline stage traits
+        static const bool PROVIDES_ELAPSED = false;
+        static const bool REQUIRES_ELAPSED = false;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LowPassStage::LowPassStage
+        ///
+        /// @param  [in]  fAlpha    Smoothing factor, 1 passes the input through and smaller values smooth more.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit LowPassStage(float fAlpha = 1.0f) : m_fAlpha(fAlpha), m_bInitialCall(true), m_fOutput(0.0f) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: LowPassStage::Process
+        ///
+        /// @return filtered value
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Sample>
+        float Process(float fValue, Sample &)
+        {
+            if (App::IsFinite(fValue))
+            {
+                m_fOutput = m_bInitialCall ? fValue : (m_fOutput + (m_fAlpha * (fValue - m_fOutput)));
+                m_bInitialCall = false;
+            }
+
+            return m_fOutput;
+        }
+
+        void Reset(void) { m_bInitialCall = true; m_fOutput = 0.0f; }
+
+        void SetAlpha(float fAlpha) { m_fAlpha = fAlpha; }
+
+    private:
+        float m_fAlpha;
+        bool  m_bInitialCall;
+        float m_fOutput;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // STRUCT NAME: PipelineElapsedCheck
+    ///
+    /// SATISFIED when every stage requiring the elapsed time comes after one providing it, PROVIDED being whether a
+    /// stage before Stages already did
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <bool PROVIDED, typename... Stages>
+struct PipelineElapsedCheck
+{
+    static const bool SATISFIED = true;
+};
+
+template <bool PROVIDED, typename First, typename... Rest>
+struct PipelineElapsedCheck<PROVIDED, First, Rest...>
+{
+    static const bool SATISFIED = (PROVIDED || !First::REQUIRES_ELAPSED) &&
+                                  PipelineElapsedCheck<PROVIDED || First::PROVIDES_ELAPSED, Rest...>::SATISFIED;
+};
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // CLASS NAME: BasicSignalPipeline
+    ///
+    /// A chain of stages run on each sample in turn
+    ///
+    /// @par Full Description
+    /// The stages are types, held by value and called directly, so the whole chain inlines into one function with no
+    /// virtual dispatch.  ProcessBuffer runs every stage on a sample before moving to the next sample, which compiles
+    /// to a single fused loop with no intermediate buffers between the stages.
+    ///
+    /// A stage is any type with
+    /// - template <typename Sample> float Process(float fValue, Sample & rSample),
+    /// - void Reset(void),
+    /// - static const bool PROVIDES_ELAPSED, true when it sets rSample.fElapsed and rSample.bElapsedValid,
+    /// - static const bool REQUIRES_ELAPSED, true when it reads them.
+    /// A stage requiring the elapsed time must come after one providing it, which is checked at compile time.
+    ///
+    /// For example, sanitize, convert to engineering units, differentiate twice and smooth:
+    ///
+    ///     SignalPipeline<SanitizeStage, ScaleStage, RateStage<RateUnitSec>, SecondDerivativeStage, LowPassStage>
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TimeBase, typename... Stages>
+class BasicSignalPipeline
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Timestamp type of the time base
+        typedef typename TimeBase::Tick Tick;
+
+        // Context handed to the stages
+        typedef PipelineSample<TimeBase> Sample;
+
+        // Number of stages
+        static const size_t STAGE_COUNT = sizeof...(Stages);
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::BasicSignalPipeline
+        ///
+        /// Constructor, every stage default constructed.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BasicSignalPipeline() : m_Stages() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::BasicSignalPipeline
+        ///
+        /// Constructor from configured stages, in pipeline order.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit BasicSignalPipeline(const Stages &... rStages) : m_Stages(rStages...) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::~BasicSignalPipeline
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~BasicSignalPipeline() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::Process
+        ///
+        /// Run one sample through every stage.
+        ///
+        /// @param  [in]  fValue        Sampled value.
+        /// @param  [in]  tTimestamp    Sample timestamp in time base ticks.
+        ///
+        /// @return output of the last stage
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float Process(float fValue, Tick tTimestamp)
+        {
+            Sample CurrentSample = { tTimestamp, 0.0f, false };
+
+            return ProcessStages(fValue, CurrentSample, std::integral_constant<size_t, 0>());
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::ProcessBuffer
+        ///
+        /// Run a buffer of samples through every stage in one fused pass.
+        ///
+        /// @pre    pfOutputs does not overlap the inputs, or is pfValues itself.
+        /// @post   ulCount outputs written, the same as ulCount calls of Process.
+        ///
+        /// @param  [in]  pfValues      Sampled values.
+        /// @param  [in]  ptTimestamps  Sample timestamps in time base ticks.
+        /// @param  [out] pfOutputs     Output of the last stage for each sample.
+        /// @param  [in]  ulCount       Number of samples.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void ProcessBuffer(const float * pfValues, const Tick * ptTimestamps, float * pfOutputs, uint32_t ulCount)
+        {
+            for (uint32_t ulIndex = 0; ulIndex < ulCount; ++ulIndex)
+            {
+                pfOutputs[ulIndex] = Process(pfValues[ulIndex], ptTimestamps[ulIndex]);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::Reset
+        ///
+        /// Reset every stage.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void)
+        {
+            ResetStages(std::integral_constant<size_t, 0>());
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::GetStage
+        ///
+        /// @return stage INDEX, for adjusting its configuration
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <size_t INDEX>
+        typename std::tuple_element<INDEX, std::tuple<Stages...> >::type & GetStage(void)
+        {
+            return std::get<INDEX>(m_Stages);
+        }
+
+    private:
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        static_assert(STAGE_COUNT > 0, "A pipeline needs at least one stage");
+
+        static_assert(PipelineElapsedCheck<false, Stages...>::SATISFIED,
+                      "A stage requiring the elapsed time must come after a stage providing it");
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::ProcessStages
+        ///
+        /// Run stage INDEX and, through recursion resolved at compile time, the stages after it.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <size_t INDEX>
+        float ProcessStages(float fValue, Sample & rSample, std::integral_constant<size_t, INDEX>)
+        {
+            float fOutput = std::get<INDEX>(m_Stages).Process(fValue, rSample);
+
+            return ProcessStages(fOutput, rSample, std::integral_constant<size_t, INDEX + 1>());
+        }
+
+        float ProcessStages(float fValue, Sample &, std::integral_constant<size_t, STAGE_COUNT>)
+        {
+            return fValue;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: BasicSignalPipeline::ResetStages
+        ///
+        /// Reset stage INDEX and the stages after it.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <size_t INDEX>
+        void ResetStages(std::integral_constant<size_t, INDEX>)
+        {
+            std::get<INDEX>(m_Stages).Reset();
+
+            ResetStages(std::integral_constant<size_t, INDEX + 1>());
+        }
+
+        void ResetStages(std::integral_constant<size_t, STAGE_COUNT>)
+        {
+        }
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        std::tuple<Stages...> m_Stages;
+};
+
+// Pipeline over the 32 bit microsecond timestamps of RateOfChange
+template <typename... Stages>
+using SignalPipeline = BasicSignalPipeline<TimeBaseUs32, Stages...>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// RateStage::Process
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename RateUnit>
+template <typename Sample>
+inline float RateStage<RateUnit>::Process(float fValue, Sample & rSample)
+{
+    typedef typename Sample::TimeBase TimeBase;
+    typedef typename Sample::Tick Tick;
+
+    // Same constant as BasicRateOfChange, so the results match it bit for bit
+    constexpr float UNITS_PER_TICK = static_cast<float>(static_cast<double>(RateUnit::UNITS_PER_SECOND) /
+                                                        static_cast<double>(TimeBase::TICKS_PER_SECOND));
+
+    float fRateOfChange = 0.0f;
+
+    rSample.bElapsedValid = !m_bInitialCall;
+
+    if (!m_bInitialCall)
+    {
+        Tick tDifference = TimeBase::Elapsed(rSample.tTimestamp, static_cast<Tick>(m_ullPreviousTimestamp));
+
+        rSample.fElapsed = static_cast<float>(tDifference) * UNITS_PER_TICK;
+
+        fRateOfChange = (tDifference != 0) ? ((fValue - m_fPreviousValue) / rSample.fElapsed) : App::FLOAT_INFINITY;
+    }
+
+    m_bInitialCall = false;
+    m_fPreviousValue = fValue;
+    m_ullPreviousTimestamp = rSample.tTimestamp;
+
+    return fRateOfChange;
+}
+
+} // SignalChain
+#endif // #if !defined(SIGNAL_PIPELINE_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TimeBase.hpp
+///
+/// Timestamp representations for the signal chain
+///
+/// @par Full Description
+/// Class header for the TimeBase policy template and the common time bases.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup SignalChain
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(TIME_BASE_HPP)
+#define TIME_BASE_HPP
+
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace SignalChain
+{
+
+    // FORWARD REFERENCES
+    // (none)
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // STRUCT NAME: TimeBase
+    ///
+    /// Describes a free running timestamp counter
+    ///
+    /// @par Full Description
+    /// TickType is the unsigned counter type and TICKS_PER_SECOND the counter clock frequency.  The counter is assumed
+    /// to overflow back to zero, so the elapsed time between two timestamps is their difference modulo the size of
+    /// TickType.  That is correct across a single overflow for any counter width and is a plain subtraction.
+    ///
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename TickType, uint64_t CLOCK_HZ>
+struct TimeBase
+{
+    // Timestamp counter type
+    typedef TickType Tick;
+
+    // Timestamp counter frequency
+    static const uint64_t TICKS_PER_SECOND = CLOCK_HZ;
+
+    static_assert(static_cast<TickType>(-1) > 0, "Timestamp counters must be unsigned");
+    static_assert(CLOCK_HZ > 0, "Timestamp counter frequency must be non zero");
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: TimeBase::Elapsed
+    ///
+    /// @param  [in]  tCurrentTimestamp    Current timestamp.
+    /// @param  [in]  tPreviousTimestamp   Previous timestamp.
+    ///
+    /// @return Ticks elapsed from the previous to the current timestamp
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    static Tick Elapsed(Tick tCurrentTimestamp, Tick tPreviousTimestamp)
+    {
+        return static_cast<Tick>(tCurrentTimestamp - tPreviousTimestamp);
+    }
+};
+
+// 32 bit microsecond timestamps, the original RateOfChange interface.  Overflows every 71.6 minutes.
+typedef TimeBase<uint32_t, 1000000U> TimeBaseUs32;
+
+// 64 bit microsecond timestamps
+typedef TimeBase<uint64_t, 1000000U> TimeBaseUs64;
+
+// 64 bit nanosecond timestamps, such as CLOCK_MONOTONIC on the Linux acquisition nodes
+typedef TimeBase<uint64_t, 1000000000U> TimeBaseNs64;
+
+} // SignalChain
+#endif // #if !defined(TIME_BASE_HPP)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TimingWheel.cpp
+///
+/// @see TimingWheel.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "TimingWheel.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::TimingWheel
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TimingWheel::TimingWheel() : m_pOverflow(0), m_ulCurrentTick(0)
+    {
+        for (uint32_t ulSlot = 0; ulSlot < SLOT_COUNT; ++ulSlot)
+        {
+            m_apLevel0[ulSlot] = 0;
+            m_apLevel1[ulSlot] = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::InitTimer
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TimingWheel::InitTimer(TimingWheelTimer & rTimer, TimingWheelTimer::Callback pfnCallback, void * pContext)
+    {
+        rTimer.pNext = 0;
+        rTimer.ppPrevNext = 0;
+        rTimer.ulExpiryTick = 0;
+        rTimer.pfnCallback = pfnCallback;
+        rTimer.pContext = pContext;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::Schedule
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TimingWheel::Schedule(TimingWheelTimer & rTimer, uint32_t ulDelayTicks)
+    {
+        Cancel(rTimer);
+
+        // The current tick's slot has already been expired, so the earliest deadline is the next tick
+        rTimer.ulExpiryTick = m_ulCurrentTick + ((ulDelayTicks != 0u) ? ulDelayTicks : 1u);
+
+        Insert(rTimer);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::Cancel
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TimingWheel::Cancel(TimingWheelTimer & rTimer)
+    {
+        if (rTimer.ppPrevNext != 0)
+        {
+            *rTimer.ppPrevNext = rTimer.pNext;
+
+            if (rTimer.pNext != 0)
+            {
+                rTimer.pNext->ppPrevNext = rTimer.ppPrevNext;
+            }
+
+            rTimer.pNext = 0;
+            rTimer.ppPrevNext = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::Advance
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TimingWheel::Advance(uint32_t ulTicks)
+    {
+        for (uint32_t ulTick = 0; ulTick < ulTicks; ++ulTick)
+        {
+            ++m_ulCurrentTick;
+
+            uint32_t ulSlot0 = m_ulCurrentTick & SLOT_MASK;
+
+            if (ulSlot0 == 0u)
+            {
+                uint32_t ulSlot1 = (m_ulCurrentTick >> SLOT_SHIFT) & SLOT_MASK;
+
+                // Level 1 has wrapped, so the overflow deadlines may now be in range.  Done first so any due in
+                // this level 1 slot are cascaded with it.
+                if (ulSlot1 == 0u)
+                {
+                    Redistribute(&m_pOverflow);
+                }
+
+                Redistribute(&m_apLevel1[ulSlot1]);
+            }
+
+            // Every timer in this slot expires now.  Callbacks can only schedule into other slots, since a timer is
+            // never scheduled for the current tick.
+            while (m_apLevel0[ulSlot0] != 0)
+            {
+                TimingWheelTimer & rTimer = *m_apLevel0[ulSlot0];
+
+                Cancel(rTimer);
+
+                rTimer.pfnCallback(rTimer.pContext);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::GetTicksToNextExpiry
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t TimingWheel::GetTicksToNextExpiry(void) const
+    {
+        for (uint32_t ulTicks = 1u; ulTicks < SLOT_COUNT; ++ulTicks)
+        {
+            if (m_apLevel0[(m_ulCurrentTick + ulTicks) & SLOT_MASK] != 0)
+            {
+                return ulTicks;
+            }
+        }
+
+        bool bPending = (m_pOverflow != 0);
+
+        for (uint32_t ulSlot = 0; (ulSlot < SLOT_COUNT) && !bPending; ++ulSlot)
+        {
+            bPending = (m_apLevel1[ulSlot] != 0);
+        }
+
+        // Later deadlines are only resolved to the tick when cascaded, so wake for the next cascade
+        return bPending ? (SLOT_COUNT - (m_ulCurrentTick & SLOT_MASK)) : NO_EXPIRY;
+    }
+
+    //**********************************************************************************************************************
+    // Private methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::Insert
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TimingWheel::Insert(TimingWheelTimer & rTimer)
+    {
+        // Modulo 2^32 subtraction handles the tick count overflowing
+        uint32_t ulDelta = rTimer.ulExpiryTick - m_ulCurrentTick;
+
+        TimingWheelTimer ** ppList = &m_pOverflow;
+
+        if (ulDelta < SLOT_COUNT)
+        {
+            ppList = &m_apLevel0[rTimer.ulExpiryTick & SLOT_MASK];
+        }
+        else if (ulDelta < WHEEL_SPAN)
+        {
+            ppList = &m_apLevel1[(rTimer.ulExpiryTick >> SLOT_SHIFT) & SLOT_MASK];
+        }
+
+        rTimer.pNext = *ppList;
+
+        if (rTimer.pNext != 0)
+        {
+            rTimer.pNext->ppPrevNext = &rTimer.pNext;
+        }
+
+        rTimer.ppPrevNext = ppList;
+        *ppList = &rTimer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// TimingWheel::Redistribute
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void TimingWheel::Redistribute(TimingWheelTimer ** ppList)
+    {
+        // Detach the whole list first, as a timer may be inserted back into the list it came from
+        TimingWheelTimer * pTimer = *ppList;
+
+        *ppList = 0;
+
+        while (pTimer != 0)
+        {
+            TimingWheelTimer * pNext = pTimer->pNext;
+
+            Insert(*pTimer);
+
+            pTimer = pNext;
+        }
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file TimingWheel.hpp
+///
+/// Description Hierarchical timing wheel class definition
+///
+/// @par Full Description
+/// TimingWheel keeps a set of deadlines in a two level hierarchical timing wheel so that scheduling, cancelling and
+/// expiring a timer are constant time regardless of how many timers are pending.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __TIMING_WHEEL_HPP__
+#define __TIMING_WHEEL_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TimingWheelTimer: TimingWheelTimer
+///
+/// A deadline held by a TimingWheel
+///
+/// @par Full Description
+/// Timers are owned by the caller and linked into the wheel, so the wheel never allocates.  A timer must not be
+/// destroyed while it is scheduled.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct TimingWheelTimer
+{
+    // Function called when the timer expires, with the timer's context
+    typedef void (*Callback)(void * pContext);
+
+    TimingWheelTimer *  pNext;          ///< Next timer in the same slot
+    TimingWheelTimer ** ppPrevNext;     ///< Link pointing at this timer, NULL when not scheduled
+    uint32_t            ulExpiryTick;   ///< Wheel tick at which the timer expires
+    Callback            pfnCallback;    ///< Called on expiry
+    void *              pContext;       ///< Passed to pfnCallback
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TimingWheel: TimingWheel
+///
+/// Two level hierarchical timing wheel
+///
+/// @par Full Description
+/// Level 0 has one slot per tick for the next SLOT_COUNT ticks.  Level 1 has one slot per SLOT_COUNT ticks for the
+/// SLOT_COUNT * SLOT_COUNT ticks after that, and its slots are cascaded down into level 0 each time level 0 wraps.
+/// Deadlines further out wait on an overflow list that is redistributed each time level 1 wraps.  Advancing the
+/// wheel therefore only touches the slot for each tick that passes plus an occasional cascade.
+///
+/// The tick period is chosen by the caller; the wheel only counts ticks.  Callbacks run from Advance and may
+/// schedule or cancel any timer, including their own.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class TimingWheel
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Slots per level
+        static const uint32_t SLOT_COUNT = 64u;
+
+        // Returned by GetTicksToNextExpiry when nothing is scheduled
+        static const uint32_t NO_EXPIRY = 0xFFFFFFFFu;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: TimingWheel::TimingWheel
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TimingWheel();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: TimingWheel::~TimingWheel
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TimingWheel() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::InitTimer
+        ///
+        /// @par Full Description
+        /// Prepares a timer for use with a wheel.
+        ///
+        /// @param  [in]  rTimer        Timer to initialize.
+        /// @param  [in]  pfnCallback   Function called when the timer expires.
+        /// @param  [in]  pContext      Passed to pfnCallback.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void InitTimer(TimingWheelTimer & rTimer, TimingWheelTimer::Callback pfnCallback, void * pContext);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::Schedule
+        ///
+        /// @par Full Description
+        /// Schedules a timer to expire ulDelayTicks after the current tick, rescheduling it if already scheduled.  A
+        /// delay of zero expires on the next tick.
+        ///
+        /// @param  [in]  rTimer        Timer to schedule.
+        /// @param  [in]  ulDelayTicks  Ticks from now to expiry.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Schedule(TimingWheelTimer & rTimer, uint32_t ulDelayTicks);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::Cancel
+        ///
+        /// @param  [in]  rTimer        Timer to cancel.  Cancelling a timer that is not scheduled has no effect.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void Cancel(TimingWheelTimer & rTimer);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::IsScheduled
+        ///
+        /// @return whether the timer is waiting to expire
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool IsScheduled(const TimingWheelTimer & rTimer) { return rTimer.ppPrevNext != 0; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::Advance
+        ///
+        /// @par Full Description
+        /// Moves the wheel forward by ulTicks, expiring every timer whose deadline is passed, in deadline order.
+        ///
+        /// @param  [in]  ulTicks       Ticks elapsed since the last call.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Advance(uint32_t ulTicks);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::GetTicksToNextExpiry
+        ///
+        /// @par Full Description
+        /// A lower bound on the ticks until the next timer expires, for a caller that wants to sleep until then.  The
+        /// bound is exact for deadlines within SLOT_COUNT ticks and otherwise falls on the next cascade.
+        ///
+        /// @return ticks until Advance next needs to be called, NO_EXPIRY when nothing is scheduled
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetTicksToNextExpiry(void) const;
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: TimingWheel::GetCurrentTick
+        ///
+        /// @return ticks the wheel has advanced since construction
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetCurrentTick(void) const { return m_ulCurrentTick; }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Bits of a tick selecting a slot within a level
+        static const uint32_t SLOT_SHIFT = 6u;
+        static const uint32_t SLOT_MASK  = SLOT_COUNT - 1u;
+
+        // Ticks covered by both levels
+        static const uint32_t WHEEL_SPAN = SLOT_COUNT * SLOT_COUNT;
+
+        static_assert((1u << SLOT_SHIFT) == SLOT_COUNT, "SLOT_SHIFT must match SLOT_COUNT");
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: TimingWheel::Insert
+        ///
+        /// Links a timer into the slot matching its expiry relative to the current tick.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Insert(TimingWheelTimer & rTimer);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: TimingWheel::Redistribute
+        ///
+        /// Unlinks every timer in a list and inserts it again relative to the current tick.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Redistribute(TimingWheelTimer ** ppList);
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Level 0, one slot per tick
+        TimingWheelTimer * m_apLevel0[SLOT_COUNT];
+
+        // Level 1, one slot per SLOT_COUNT ticks
+        TimingWheelTimer * m_apLevel1[SLOT_COUNT];
+
+        // Timers beyond the span of both levels
+        TimingWheelTimer * m_pOverflow;
+
+        // Ticks advanced since construction
+        uint32_t           m_ulCurrentTick;
+
+        // Inhibit copy constructor and assignment operator
+        TimingWheel(TimingWheel &);
+
+        TimingWheel & operator=(TimingWheel const&); // assign op. hidden
+};
+} //CpfBsp;
+
+
+#endif //__TIMING_WHEEL_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
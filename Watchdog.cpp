@@ -11,6 +11,7 @@
 /// - zjrybak 29-Feb-2016 Added additional watchdog timeouts and windowed mode option
 /// - zjrybak 14-Mar-2016 Changed Init so that it only writes to the COP register once.
 /// - thaley1 13-Jun-2016 Interface for Renesas Synergy MCUs
+/// - agent 16-Oct-2026 Added GetResetStatus
 /// @endif
 ///
 /// @ingroup CpfBsp
@@ -53,7 +54,15 @@ namespace CpfBsp
      ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
      bool Watchdog::IsWatchdogReset(void) const
      {
-         return (m_pRegMapIWdt->uwStatus & IWDT_STATUS_ERR_MASK);
+         return (GetResetStatus() != 0u);
+     }
+
+     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+     /// Watchdog::GetResetStatus
+     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+     uint16_t Watchdog::GetResetStatus(void)
+     {
+         return static_cast<uint16_t>(m_pRegMapIWdt->uwStatus & IWDT_STATUS_ERR_MASK);
      }
     
 };
@@ -16,6 +16,7 @@
 /// - zjrybak 29-Feb-2016 Added additional watchdog timeouts and windowed mode option
 /// - zjrybak 14-Mar-2016 Removed DisableWatchdog and moved disable into the Init
 /// - thaley1 13-Jun-2016 Modified for switch to Renesas Synergy MCUs
+/// - agent 16-Oct-2026 Added GetResetStatus and the traced KickWatchdog
 /// @endif
 ///
 /// @ingroup CpfBsp
@@ -32,7 +33,7 @@
 #include "Registers.h"
 
 // C++ PROJECT INCLUDES
-// (none)
+#include "WatchdogTrace.hpp"
 
 namespace CpfBsp
 {
@@ -72,6 +73,14 @@ namespace CpfBsp
 class Watchdog
 {
     public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Reset status flags returned by GetResetStatus
+        static const uint16_t STATUS_UNDERFLOW     = 0x4000u;   ///< UNDFF, no refresh within the timeout
+        static const uint16_t STATUS_REFRESH_ERROR = 0x8000u;   ///< REFEF, refreshed outside the window
+
         //**************************************************************************************************************
         // Public methods
         //**************************************************************************************************************
@@ -111,6 +120,25 @@ class Watchdog
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void KickWatchdog(void);
 
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: Watchdog::KickWatchdog
+        ///
+        /// @par Full Description
+        /// KickWatchdog that first records the kick in the WatchdogTrace, so that a refresh made outside the window,
+        /// which resets at once, is still in the trace.
+        ///
+        /// @param  [in]  ulCallerId   Identifies the caller in the trace, 0 to 255.
+        /// @param  [in]  ulNowUs      Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void KickWatchdog(uint32_t ulCallerId, uint32_t ulNowUs)
+        {
+            WatchdogTrace::Record(TRACE_KICK, ulCallerId, ulNowUs);
+
+            KickWatchdog();
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// FUNCTION NAME: Watchdog::IsWatchdogReset
         ///
@@ -128,6 +156,17 @@ class Watchdog
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool IsWatchdogReset(void) const;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: Watchdog::GetResetStatus
+        ///
+        /// @par Full Description
+        /// Reads the cause of a watchdog reset from the independent watchdog timer status register.  The flags
+        /// survive the reset, so this is read at startup, typically through WatchdogTrace::ReadResetReport.
+        ///
+        /// @return STATUS_UNDERFLOW and STATUS_REFRESH_ERROR flags set, 0 when the reset was not a watchdog reset
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint16_t GetResetStatus(void);
+
 
     private:
 
@@ -143,7 +182,7 @@ class Watchdog
         static const uint8_t  SECOND_REFRESH_BYTE  = 0xffu;
 
         // Status bit mask
-        static const uint16_t IWDT_STATUS_ERR_MASK = 0xC000u;
+        static const uint16_t IWDT_STATUS_ERR_MASK = STATUS_UNDERFLOW | STATUS_REFRESH_ERROR;
         
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// METHOD NAME: Watchdog::Watchdog
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogMonitor.cpp
+///
+/// @see WatchdogMonitor.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Recorded from one context, the counts at Reset kept instead of clearing them
+/// - agent 16-Oct-2026 Refreshes are recorded in the WatchdogTrace
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "WatchdogMonitor.hpp"
+#include "Watchdog.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogMonitor::WatchdogMonitor
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    WatchdogMonitor::WatchdogMonitor(const WatchdogWindow & rWindow)
+        : m_ulEarlyResetCount(0u),
+          m_ulLateResetCount(0u),
+          m_ulOpenUs(rWindow.GetOpenUs()),
+          m_ulCloseUs(rWindow.GetCloseUs())
+    {
+        m_ulLastKickUs.store(0u, std::memory_order_relaxed);
+        m_ulEarlyCount.store(0u, std::memory_order_relaxed);
+        m_ulLateCount.store(0u, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogMonitor::Start
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WatchdogMonitor::Start(uint32_t ulNowUs)
+    {
+        m_ulLastKickUs.store(ulNowUs, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogMonitor::KickWatchdog
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WatchdogMonitor::KickWatchdog(uint32_t ulNowUs)
+    {
+        Watchdog::KickWatchdog(TRACE_CALLER_MONITOR, ulNowUs);
+
+        Record(ulNowUs);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogMonitor::Record
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WatchdogMonitor::Record(uint32_t ulNowUs)
+    {
+        // The recording context is the only writer, so plain loads and stores.  Modulo 2^32 subtraction handles a
+        // timestamp overflow since the last refresh.
+        uint32_t ulIntervalUs = ulNowUs - m_ulLastKickUs.load(std::memory_order_relaxed);
+
+        m_ulLastKickUs.store(ulNowUs, std::memory_order_relaxed);
+
+        m_IntervalHistogram.Record(ulIntervalUs);
+
+        if (ulIntervalUs < m_ulOpenUs)
+        {
+            m_ulEarlyCount.store(m_ulEarlyCount.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_OpenMarginHistogram.Record(ulIntervalUs - m_ulOpenUs);
+        }
+
+        if (ulIntervalUs > m_ulCloseUs)
+        {
+            m_ulLateCount.store(m_ulLateCount.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_CloseMarginHistogram.Record(m_ulCloseUs - ulIntervalUs);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogMonitor::Reset
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WatchdogMonitor::Reset(void)
+    {
+        m_IntervalHistogram.Reset();
+        m_OpenMarginHistogram.Reset();
+        m_CloseMarginHistogram.Reset();
+
+        // The counts belong to the recording context, so the counts at the reset are kept instead of clearing them
+        m_ulEarlyResetCount = m_ulEarlyCount.load(std::memory_order_relaxed);
+        m_ulLateResetCount = m_ulLateCount.load(std::memory_order_relaxed);
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogMonitor.hpp
+///
+/// Description Watchdog refresh timing instrumentation
+///
+/// @par Full Description
+/// Class header for the WatchdogMonitor class, which records how the watchdog refreshes are timed relative to the
+/// timeout and the refresh window.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Recorded from one context, the counts at Reset kept instead of clearing them
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WATCHDOG_MONITOR_HPP__
+#define __WATCHDOG_MONITOR_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "LatencyHistogram.hpp"
+#include "WatchdogWindow.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WatchdogMonitor: WatchdogMonitor
+///
+/// Refreshes the watchdog and records the timing of each refresh
+///
+/// @par Full Description
+/// Watchdog::IsWatchdogReset reports that a watchdog reset happened, but not how close the refreshes had been
+/// running to the timeout beforehand.  KickWatchdog here refreshes the watchdog like Watchdog::KickWatchdog and
+/// records three histograms in microseconds:
+/// - the interval since the previous refresh,
+/// - the margin after the refresh window opened, and
+/// - the margin before the refresh window closed.
+/// A refresh outside the window has no margin on that side and is counted as early or late instead.  Watching the
+/// low percentiles of the margins over time shows latency creep long before it turns into a reset.
+///
+/// Recording is wait-free, a handful of relaxed atomic loads and stores with no read-modify-write, so KickWatchdog
+/// can replace Watchdog::KickWatchdog on the refresh path.  The price is one recording context: KickWatchdog,
+/// Record and Start are called from the context that refreshes the watchdog.  The histograms and counts are read,
+/// and reset, from one diagnostics context while the refreshes continue.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class WatchdogMonitor
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // 16 buckets per power of two, each value resolved to within 6.25%
+        typedef LatencyHistogram<5u> Histogram;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogMonitor::WatchdogMonitor
+        ///
+        /// @par Full Description
+        /// Constructor
+        ///
+        /// @param  [in]  rWindow   Watchdog timeout and refresh window programmed in OFS0.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WatchdogMonitor(const WatchdogWindow & rWindow);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogMonitor::~WatchdogMonitor
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WatchdogMonitor() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::Start
+        ///
+        /// @par Full Description
+        /// Marks the start of the first watchdog timer cycle measured, normally the reset.
+        ///
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Start(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::KickWatchdog
+        ///
+        /// @par Full Description
+        /// Refreshes the watchdog and records the refresh timing.  The refresh is recorded in the WatchdogTrace
+        /// under TRACE_CALLER_MONITOR.
+        ///
+        /// @pre    Start has been called.
+        /// @post   Watchdog refreshed.
+        ///
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void KickWatchdog(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::Record
+        ///
+        /// @par Full Description
+        /// Records the timing of a refresh issued elsewhere, without touching the watchdog.
+        ///
+        /// @param  [in]  ulNowUs   Time of the refresh in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Record(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::GetIntervalHistogram
+        ///
+        /// @return histogram of the time between refreshes
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Histogram & GetIntervalHistogram(void) { return m_IntervalHistogram; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::GetOpenMarginHistogram
+        ///
+        /// @return histogram of the time from the window opening to the refresh
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Histogram & GetOpenMarginHistogram(void) { return m_OpenMarginHistogram; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::GetCloseMarginHistogram
+        ///
+        /// @return histogram of the time from the refresh to the window closing
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Histogram & GetCloseMarginHistogram(void) { return m_CloseMarginHistogram; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::GetEarlyCount
+        ///
+        /// @return refreshes before the window opened since the last Reset
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetEarlyCount(void) const
+        {
+            return m_ulEarlyCount.load(std::memory_order_relaxed) - m_ulEarlyResetCount;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::GetLateCount
+        ///
+        /// @return refreshes after the window closed since the last Reset
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetLateCount(void) const
+        {
+            return m_ulLateCount.load(std::memory_order_relaxed) - m_ulLateResetCount;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogMonitor::Reset
+        ///
+        /// @par Full Description
+        /// Starts the histograms and counts afresh.  The refresh timing continues from the last refresh.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void Reset(void);
+
+    private:
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Time of the last refresh
+        std::atomic<uint32_t> m_ulLastKickUs;
+
+        // Refreshes outside the window, free running and written by the recording context only
+        std::atomic<uint32_t> m_ulEarlyCount;
+        std::atomic<uint32_t> m_ulLateCount;
+
+        // Refreshes outside the window at the last Reset, written by the diagnostics context only
+        uint32_t              m_ulEarlyResetCount;
+        uint32_t              m_ulLateResetCount;
+
+        // Window edges measured from the start of the cycle
+        uint32_t              m_ulOpenUs;
+        uint32_t              m_ulCloseUs;
+
+        Histogram             m_IntervalHistogram;
+        Histogram             m_OpenMarginHistogram;
+        Histogram             m_CloseMarginHistogram;
+
+        // Inhibit copy constructor and assignment operator
+        WatchdogMonitor(WatchdogMonitor &);
+
+        WatchdogMonitor & operator=(WatchdogMonitor const&); // assign op. hidden
+};
+} //CpfBsp;
+
+
+#endif //__WATCHDOG_MONITOR_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogPolicy.hpp
+///
+/// Description Compile time watchdog configuration and refresh scheduling
+///
+/// @par Full Description
+/// Class header and implementation of the IWdtConfig, WatchdogPolicy and PeriodicKicker class templates, which carry
+/// the OFS0 watchdog settings as constants so that windows and deadlines are computed, and loop periods checked
+/// against them, at compile time.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Corrected the clock tolerance of the window edges, a slow clock opens the window later
+/// - agent 16-Oct-2026 Refreshes are recorded in the WatchdogTrace
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WATCHDOG_POLICY_HPP__
+#define __WATCHDOG_POLICY_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "Watchdog.hpp"
+#include "WatchdogWindow.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IWdtConfig: IWdtConfig
+///
+/// Independent watchdog settings as programmed in OFS0
+///
+/// @par Full Description
+/// Derives the timeout from the IWDT clock, the clock division ratio and the timeout period in cycles, rejecting
+/// values OFS0 cannot hold.  A configuration for WatchdogPolicy is any type with the same four constants, so a
+/// board that knows its timeout directly can declare them itself.
+///
+/// For example the S3A7 default IWDT clock of 15 kHz divided by 128 with a 1024 cycle timeout and a 25% to 75%
+/// window, allowing for a 10% clock error:
+/// @code
+/// typedef IWdtConfig<15000u, 128u, 1024u, WINDOW_START_25, WINDOW_END_75, 10u> BoardIWdtConfig;
+/// @endcode
+/// which gives a nominal window of 2184533 us to 6553599 us, and refreshes permitted from 2427260 us to 5957817 us.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t CLOCK_HZ, uint32_t CLOCK_DIVIDER, uint32_t TIMEOUT_CYCLES, WindowStart START, WindowEnd END,
+          uint32_t CLOCK_TOLERANCE = 0u>
+struct IWdtConfig
+{
+    static_assert(CLOCK_HZ != 0u, "The IWDT clock must be given");
+    static_assert((CLOCK_DIVIDER == 1u) || (CLOCK_DIVIDER == 16u) || (CLOCK_DIVIDER == 32u) ||
+                  (CLOCK_DIVIDER == 64u) || (CLOCK_DIVIDER == 128u) || (CLOCK_DIVIDER == 256u),
+                  "OFS0 divides the IWDT clock by 1, 16, 32, 64, 128 or 256");
+    static_assert((TIMEOUT_CYCLES == 128u) || (TIMEOUT_CYCLES == 512u) || (TIMEOUT_CYCLES == 1024u) ||
+                  (TIMEOUT_CYCLES == 2048u),
+                  "OFS0 times out after 128, 512, 1024 or 2048 cycles");
+
+    // Nominal watchdog timer cycle in microseconds
+    static const uint32_t TIMEOUT_US = static_cast<uint32_t>(
+        (static_cast<uint64_t>(TIMEOUT_CYCLES) * CLOCK_DIVIDER * 1000000u) / CLOCK_HZ);
+
+    // Refresh window
+    static const WindowStart WINDOW_START = START;
+    static const WindowEnd   WINDOW_END = END;
+
+    // Largest error of the IWDT clock in percent, either way
+    static const uint32_t CLOCK_TOLERANCE_PERCENT = CLOCK_TOLERANCE;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WatchdogPolicy: WatchdogPolicy
+///
+/// The watchdog with its configuration known at compile time
+///
+/// @par Full Description
+/// The window edges are compile time constants, and so are the checks and deadlines built on them, which reduce to
+/// a compare or an add.  KickWatchdog is Watchdog::KickWatchdog inlined, so the policy costs nothing at run time.
+///
+/// The clock tolerance is applied against the window: a refresh is only taken as permitted once the window has
+/// opened on the slowest clock and before it closes on the fastest.  GetWindow gives the nominal window for the
+/// run time classes, KickScheduler and WatchdogMonitor, and the host simulator.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename Config>
+class WatchdogPolicy
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        static_assert(Config::TIMEOUT_US != 0u, "The watchdog timeout must not be zero");
+        static_assert(static_cast<uint32_t>(Config::WINDOW_START) < static_cast<uint32_t>(Config::WINDOW_END),
+                      "The refresh window must end after it begins");
+        static_assert(Config::CLOCK_TOLERANCE_PERCENT < WatchdogWindow::CYCLE_PERCENT,
+                      "The clock tolerance must be under 100%");
+
+        // Nominal cycle and window edges, microseconds from the start of the cycle
+        static const uint32_t TIMEOUT_US = Config::TIMEOUT_US;
+        static const uint32_t OPEN_US = static_cast<uint32_t>(
+            (static_cast<uint64_t>(TIMEOUT_US) * Config::WINDOW_START) / WatchdogWindow::CYCLE_PERCENT);
+        static const uint32_t CLOSE_US = static_cast<uint32_t>(
+            (static_cast<uint64_t>(TIMEOUT_US) * Config::WINDOW_END) / WatchdogWindow::CYCLE_PERCENT);
+
+        //
+        // Window edges allowing for the clock tolerance, rounded inwards.  A clock tol% slow stretches the cycle by
+        // 100 / (100 - tol), so the window opens latest at OPEN_US * 100 / (100 - tol), and one tol% fast shrinks it
+        // by 100 / (100 + tol), so the window closes earliest at CLOSE_US * 100 / (100 + tol).  Both are taken from
+        // TIMEOUT_US in one step so the rounding of OPEN_US and CLOSE_US is not compounded.
+        //
+        static const uint32_t SAFE_OPEN_US = static_cast<uint32_t>(
+            ((static_cast<uint64_t>(TIMEOUT_US) * Config::WINDOW_START) +
+             (WatchdogWindow::CYCLE_PERCENT - Config::CLOCK_TOLERANCE_PERCENT - 1u)) /
+            (WatchdogWindow::CYCLE_PERCENT - Config::CLOCK_TOLERANCE_PERCENT));
+        static const uint32_t SAFE_CLOSE_US = static_cast<uint32_t>(
+            (static_cast<uint64_t>(TIMEOUT_US) * Config::WINDOW_END) /
+            (WatchdogWindow::CYCLE_PERCENT + Config::CLOCK_TOLERANCE_PERCENT));
+
+        static_assert(SAFE_OPEN_US <= SAFE_CLOSE_US, "The clock tolerance closes the refresh window completely");
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogPolicy::GetWindow
+        ///
+        /// @return the nominal timeout and window
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr WatchdogWindow GetWindow(void)
+        {
+            return WatchdogWindow{ TIMEOUT_US, Config::WINDOW_START, Config::WINDOW_END };
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogPolicy::IsRefreshPermitted
+        ///
+        /// @param  [in]  ulElapsedUs  Time since the last refresh in microseconds.
+        ///
+        /// @return whether a refresh at ulElapsedUs is inside the window whatever the clock error
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr bool IsRefreshPermitted(uint32_t ulElapsedUs)
+        {
+            return (ulElapsedUs >= SAFE_OPEN_US) && (ulElapsedUs <= SAFE_CLOSE_US);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogPolicy::GetOpenTimeUs
+        ///
+        /// @param  [in]  ulLastKickUs  Time of the last refresh in microseconds.
+        ///
+        /// @return earliest time of the next refresh, modulo 2^32
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr uint32_t GetOpenTimeUs(uint32_t ulLastKickUs) { return ulLastKickUs + SAFE_OPEN_US; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogPolicy::GetDeadlineUs
+        ///
+        /// @param  [in]  ulLastKickUs  Time of the last refresh in microseconds.
+        ///
+        /// @return latest time of the next refresh, modulo 2^32
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr uint32_t GetDeadlineUs(uint32_t ulLastKickUs) { return ulLastKickUs + SAFE_CLOSE_US; }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogPolicy::KickWatchdog
+        ///
+        /// @par Full Description
+        /// Refreshes the watchdog and records it in the WatchdogTrace, see Watchdog::KickWatchdog.
+        ///
+        /// @param  [in]  ulCallerId   Identifies the caller in the trace, 0 to 255.
+        /// @param  [in]  ulNowUs      Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void KickWatchdog(uint32_t ulCallerId, uint32_t ulNowUs) { Watchdog::KickWatchdog(ulCallerId, ulNowUs); }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogPolicy::WatchdogPolicy
+        ///
+        /// Constructor, the policy is used through its static members only
+        ///
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WatchdogPolicy() {}
+
+        // Inhibit copy constructor and assignment operator
+        WatchdogPolicy(WatchdogPolicy &);
+
+        WatchdogPolicy & operator=(WatchdogPolicy const&); // assign op. hidden
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PeriodicKicker: PeriodicKicker
+///
+/// Refreshes the watchdog from a loop of known period, checked against the window at compile time
+///
+/// @par Full Description
+/// Tick is called once per pass of a loop that runs every LOOP_PERIOD_US, give or take LOOP_JITTER_US.  It refreshes
+/// the watchdog every KICK_EVERY passes, the fewest that cannot be early for the window, and the build fails when
+/// that many passes can be late for it, so a loop that cannot hit the window never reaches the target.
+///
+/// The first refresh comes KICK_EVERY passes after the first Tick, so the loop must start within the same bounds
+/// of the reset or of a previous refresh.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename Policy, uint32_t LOOP_PERIOD_US, uint32_t LOOP_JITTER_US = 0u>
+class PeriodicKicker
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        static_assert(LOOP_JITTER_US < LOOP_PERIOD_US, "The loop jitter must be less than its period");
+
+        // Passes of the loop per refresh
+        static const uint32_t KICK_EVERY = (Policy::SAFE_OPEN_US <= (LOOP_PERIOD_US - LOOP_JITTER_US)) ? 1u :
+            ((Policy::SAFE_OPEN_US + (LOOP_PERIOD_US - LOOP_JITTER_US) - 1u) / (LOOP_PERIOD_US - LOOP_JITTER_US));
+
+        static_assert((static_cast<uint64_t>(KICK_EVERY) * (LOOP_PERIOD_US + LOOP_JITTER_US)) <= Policy::SAFE_CLOSE_US,
+                      "The loop period cannot hit the watchdog refresh window");
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: PeriodicKicker::PeriodicKicker
+        ///
+        /// Constructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PeriodicKicker() : m_ulPasses(0u) {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: PeriodicKicker::~PeriodicKicker
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~PeriodicKicker() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: PeriodicKicker::Tick
+        ///
+        /// @par Full Description
+        /// Counts a pass of the loop and refreshes the watchdog on every KICK_EVERY th, recording the refresh in the
+        /// WatchdogTrace under TRACE_CALLER_PERIODIC_KICKER.  With KICK_EVERY of 1 the count folds away and this is
+        /// KickWatchdog.
+        ///
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return whether the watchdog was refreshed
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Tick(uint32_t ulNowUs)
+        {
+            bool bKicked = false;
+
+            if ((KICK_EVERY == 1u) || (++m_ulPasses == KICK_EVERY))
+            {
+                m_ulPasses = 0u;
+
+                Policy::KickWatchdog(TRACE_CALLER_PERIODIC_KICKER, ulNowUs);
+
+                bKicked = true;
+            }
+
+            return bKicked;
+        }
+
+    private:
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Passes since the last refresh
+        uint32_t m_ulPasses;
+
+        // Inhibit copy constructor and assignment operator
+        PeriodicKicker(PeriodicKicker &);
+
+        PeriodicKicker & operator=(PeriodicKicker const&); // assign op. hidden
+};
+
+// The example of the IWdtConfig description, worked by hand
+static_assert(WatchdogPolicy<IWdtConfig<15000u, 128u, 1024u, WINDOW_START_25, WINDOW_END_75, 10u> >::OPEN_US ==
+              2184533u, "IWdtConfig example window open");
+static_assert(WatchdogPolicy<IWdtConfig<15000u, 128u, 1024u, WINDOW_START_25, WINDOW_END_75, 10u> >::CLOSE_US ==
+              6553599u, "IWdtConfig example window close");
+static_assert(WatchdogPolicy<IWdtConfig<15000u, 128u, 1024u, WINDOW_START_25, WINDOW_END_75, 10u> >::SAFE_OPEN_US ==
+              2427260u, "IWdtConfig example window open on a 10% slow clock");
+static_assert(WatchdogPolicy<IWdtConfig<15000u, 128u, 1024u, WINDOW_START_25, WINDOW_END_75, 10u> >::SAFE_CLOSE_US ==
+              5957817u, "IWdtConfig example window close on a 10% fast clock");
+
+} //CpfBsp;
+
+
+#endif //__WATCHDOG_POLICY_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
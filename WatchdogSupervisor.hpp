@@ -0,0 +1,366 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogSupervisor.hpp
+///
+/// Description Multi-task software watchdog in front of the hardware watchdog
+///
+/// @par Full Description
+/// Class header and implementation of the WatchdogSupervisor class template.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added WatchdogTrace records of check-ins, refreshes and withheld refreshes
+/// - agent 16-Oct-2026 Check-ins are traced by Service, the trace's one writer, for tasks registered to be traced
+/// - agent 16-Oct-2026 Per task check-in counts in place of the shared check-in bitmask
+/// - agent 16-Oct-2026 A withheld refresh is traced once per late task rather than on every Service
+/// - agent 16-Oct-2026 Refreshes requested from a KickScheduler so they land inside the window
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WATCHDOG_SUPERVISOR_HPP__
+#define __WATCHDOG_SUPERVISOR_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "KickScheduler.hpp"
+#include "WatchdogTrace.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WatchdogSupervisor: WatchdogSupervisor
+///
+/// Refreshes the hardware watchdog only while every registered task is alive
+///
+/// @par Full Description
+/// Watchdog::KickWatchdog may be called from any thread, so one healthy thread can keep the board alive while every
+/// other task is hung.  The supervisor sits in front of it.  Each task registers with its own deadline and then
+/// calls CheckIn from its loop.  A check-in advances the task's own check-in count, a load and a store with no lock
+/// and no read-modify-write, so it can sit on the fastest loops.  Service compares each count with the one it saw
+/// last time, so it never clears anything a task writes and no check-in is lost between the two.
+///
+/// A shared bitmask of check-ins would need an atomic OR, which SampleRing explains is costly on the Cortex-M0+.
+/// The price of the counts is one word per task, and that each task identifier checks in from one thread or
+/// interrupt only.
+///
+/// Service collects the check-ins and, when every registered task has checked in within its own deadline, asks a
+/// KickScheduler for a refresh.  The scheduler issues it inside the refresh window, since with a windowed OFS0
+/// setting a refresh whenever the tasks are healthy would come before the window opens and reset a healthy board.
+/// While a task is late the request is withdrawn, the scheduler misses the window and the hardware watchdog resets
+/// the board.  Service is called periodically from the timer context that calls KickScheduler::Tick, just before
+/// it, and more often than the time from the window midpoint to its close so that a request is always fresh.
+///
+/// A check-in is timed at the Service that collects it, not when the task made it, so a task can go up to its
+/// deadline plus one Service period between check-ins before it is found late.  Choose the deadline with that
+/// slack in mind.
+///
+/// Tasks are registered and unregistered from the supervisor context, or before the other tasks start.
+///
+/// When a WatchdogTrace region is attached, the scheduler records each refresh and Service records the late task
+/// when it first withholds the refresh for it.  For tasks registered with bTraceCheckIns it also records the
+/// check-ins it collects, at the time of the Service, so the trace keeps one writer and a check-in costs the task
+/// nothing more.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t TASK_COUNT>
+class WatchdogSupervisor
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Returned by GetLateTask when no task is late
+        static const uint32_t NO_TASK = 0xFFFFFFFFu;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogSupervisor::WatchdogSupervisor
+        ///
+        /// @par Full Description
+        /// Constructor
+        ///
+        /// @param  [in]  rScheduler   Scheduler that refreshes the watchdog inside its window when asked.
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WatchdogSupervisor(KickScheduler & rScheduler);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogSupervisor::~WatchdogSupervisor
+        ///
+        /// Destructor
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WatchdogSupervisor() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogSupervisor::RegisterTask
+        ///
+        /// @par Full Description
+        /// Requires a task to check in at least once every ulDeadlineUs, plus the Service period, for the watchdog
+        /// to be refreshed.  The task counts as having checked in at ulNowUs.
+        ///
+        /// @pre    Called from the supervisor context.
+        /// @post   Task supervised.
+        ///
+        /// @param  [in]  ulTaskId         Task identifier, less than TASK_COUNT.
+        /// @param  [in]  ulDeadlineUs     Longest time allowed between check-ins in microseconds.
+        /// @param  [in]  ulNowUs          Current time in microseconds.
+        /// @param  [in]  bTraceCheckIns   Whether Service records the task's check-ins in the WatchdogTrace.
+        ///
+        /// @return whether the task was registered
+        /// @retval true:  the task was registered
+        /// @retval false: the task identifier is out of range
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool RegisterTask(uint32_t ulTaskId, uint32_t ulDeadlineUs, uint32_t ulNowUs, bool bTraceCheckIns = false);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogSupervisor::UnregisterTask
+        ///
+        /// @par Full Description
+        /// Stops supervising a task, for example one that is shutting down.
+        ///
+        /// @pre    Called from the supervisor context.
+        /// @post   Task no longer supervised.
+        ///
+        /// @param  [in]  ulTaskId     Task identifier, less than TASK_COUNT.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void UnregisterTask(uint32_t ulTaskId);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogSupervisor::CheckIn
+        ///
+        /// @par Full Description
+        /// Reports that a task is alive.  One load and one store of the task's count.
+        ///
+        /// @pre    ulTaskId less than TASK_COUNT, and the task checks in from one thread or interrupt only.
+        /// @post   Check-in recorded for the next Service.
+        ///
+        /// @param  [in]  ulTaskId     Task identifier.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void CheckIn(uint32_t ulTaskId)
+        {
+            // The task is the only writer of its count
+            m_aulCheckInCounts[ulTaskId].store(m_aulCheckInCounts[ulTaskId].load(std::memory_order_relaxed) + 1u,
+                                               std::memory_order_relaxed);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogSupervisor::Service
+        ///
+        /// @par Full Description
+        /// Collects the check-ins since the last call and asks the KickScheduler for a refresh when every registered
+        /// task is within its deadline, or withdraws the request when one is not.
+        ///
+        /// @pre    Called periodically from the context of KickScheduler::Tick, more often than the time from the
+        ///         window midpoint to its close.
+        /// @post   Refresh requested when all tasks are alive, withdrawn otherwise.
+        ///
+        /// @param  [in]  ulNowUs      Current time in microseconds.
+        ///
+        /// @return whether a refresh was requested
+        /// @retval true:  every registered task is alive and a refresh was requested
+        /// @retval false: a task missed its deadline and the refresh was withheld
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool Service(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogSupervisor::GetLateTask
+        ///
+        /// @return lowest numbered task that missed its deadline at the last Service, NO_TASK if none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        uint32_t GetLateTask(void) const { return m_ulLateTask; }
+
+    private:
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Tasks per bitmask word
+        static const uint32_t WORD_SHIFT = 5u;
+        static const uint32_t WORD_MASK  = 31u;
+        static const uint32_t WORD_COUNT = (TASK_COUNT + WORD_MASK) >> WORD_SHIFT;
+
+        static_assert(TASK_COUNT > 0, "A supervisor needs at least one task");
+
+        //**************************************************************************************************************
+        // Member variables
+        //**************************************************************************************************************
+
+        // Issues the refreshes inside the window
+        KickScheduler &       m_rScheduler;
+
+        // Check-in count of each task, advanced by the task only
+        std::atomic<uint32_t> m_aulCheckInCounts[TASK_COUNT];
+
+        // Check-in count of each task at the last Service
+        uint32_t              m_aulSeenCounts[TASK_COUNT];
+
+        // Registered bit of each task
+        uint32_t              m_aulRegistered[WORD_COUNT];
+
+        // Bit of each task whose check-ins are traced
+        uint32_t              m_aulTraced[WORD_COUNT];
+
+        // Deadline of each task in microseconds
+        uint32_t              m_aulDeadlineUs[TASK_COUNT];
+
+        // Time of the last check-in Service saw for each task
+        uint32_t              m_aulLastCheckInUs[TASK_COUNT];
+
+        // Lowest numbered late task at the last Service
+        uint32_t              m_ulLateTask;
+
+        // Inhibit copy constructor and assignment operator
+        WatchdogSupervisor(WatchdogSupervisor &);
+
+        WatchdogSupervisor & operator=(WatchdogSupervisor const&); // assign op. hidden
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// WatchdogSupervisor::WatchdogSupervisor
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t TASK_COUNT>
+WatchdogSupervisor<TASK_COUNT>::WatchdogSupervisor(KickScheduler & rScheduler)
+    : m_rScheduler(rScheduler),
+      m_ulLateTask(NO_TASK)
+{
+    for (uint32_t ulWord = 0; ulWord < WORD_COUNT; ++ulWord)
+    {
+        m_aulRegistered[ulWord] = 0u;
+        m_aulTraced[ulWord] = 0u;
+    }
+
+    for (uint32_t ulTaskId = 0; ulTaskId < TASK_COUNT; ++ulTaskId)
+    {
+        m_aulCheckInCounts[ulTaskId].store(0u, std::memory_order_relaxed);
+        m_aulSeenCounts[ulTaskId] = 0u;
+        m_aulDeadlineUs[ulTaskId] = 0u;
+        m_aulLastCheckInUs[ulTaskId] = 0u;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// WatchdogSupervisor::RegisterTask
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t TASK_COUNT>
+bool WatchdogSupervisor<TASK_COUNT>::RegisterTask(uint32_t ulTaskId, uint32_t ulDeadlineUs, uint32_t ulNowUs,
+                                                  bool bTraceCheckIns)
+{
+    bool bRegistered = false;
+
+    if (ulTaskId < TASK_COUNT)
+    {
+        uint32_t ulBit = 1u << (ulTaskId & WORD_MASK);
+
+        m_aulDeadlineUs[ulTaskId] = ulDeadlineUs;
+        m_aulLastCheckInUs[ulTaskId] = ulNowUs;
+        m_aulSeenCounts[ulTaskId] = m_aulCheckInCounts[ulTaskId].load(std::memory_order_relaxed);
+        m_aulRegistered[ulTaskId >> WORD_SHIFT] |= ulBit;
+        m_aulTraced[ulTaskId >> WORD_SHIFT] = bTraceCheckIns ? (m_aulTraced[ulTaskId >> WORD_SHIFT] | ulBit) :
+                                                               (m_aulTraced[ulTaskId >> WORD_SHIFT] & ~ulBit);
+
+        bRegistered = true;
+    }
+
+    return bRegistered;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// WatchdogSupervisor::UnregisterTask
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t TASK_COUNT>
+void WatchdogSupervisor<TASK_COUNT>::UnregisterTask(uint32_t ulTaskId)
+{
+    if (ulTaskId < TASK_COUNT)
+    {
+        m_aulRegistered[ulTaskId >> WORD_SHIFT] &= ~(1u << (ulTaskId & WORD_MASK));
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// WatchdogSupervisor::Service
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <uint32_t TASK_COUNT>
+bool WatchdogSupervisor<TASK_COUNT>::Service(uint32_t ulNowUs)
+{
+    uint32_t ulPreviousLateTask = m_ulLateTask;
+
+    m_ulLateTask = NO_TASK;
+
+    for (uint32_t ulWord = 0; ulWord < WORD_COUNT; ++ulWord)
+    {
+        for (uint32_t ulPending = m_aulRegistered[ulWord]; ulPending != 0u; ulPending &= (ulPending - 1u))
+        {
+            uint32_t ulBit = static_cast<uint32_t>(__builtin_ctz(ulPending));
+            uint32_t ulTaskId = (ulWord << WORD_SHIFT) + ulBit;
+
+            // A count that has moved on since the last Service is a check-in, however many times it moved
+            uint32_t ulCount = m_aulCheckInCounts[ulTaskId].load(std::memory_order_relaxed);
+
+            if (ulCount != m_aulSeenCounts[ulTaskId])
+            {
+                m_aulSeenCounts[ulTaskId] = ulCount;
+                m_aulLastCheckInUs[ulTaskId] = ulNowUs;
+
+                if ((m_aulTraced[ulWord] & (1u << ulBit)) != 0u)
+                {
+                    WatchdogTrace::Record(TRACE_CHECK_IN, ulTaskId, ulNowUs);
+                }
+            }
+            // Modulo 2^32 subtraction handles a timestamp overflow since the last check-in
+            else if (((ulNowUs - m_aulLastCheckInUs[ulTaskId]) > m_aulDeadlineUs[ulTaskId]) &&
+                     (m_ulLateTask == NO_TASK))
+            {
+                m_ulLateTask = ulTaskId;
+            }
+        }
+    }
+
+    bool bRequested = (m_ulLateTask == NO_TASK);
+
+    if (bRequested)
+    {
+        m_rScheduler.RequestKick();
+    }
+    else
+    {
+        // A request from before the task went late must not be acted on
+        m_rScheduler.CancelKick();
+
+        // Recorded when the task first goes late only, so the entries that led up to the hang stay in the trace
+        if (m_ulLateTask != ulPreviousLateTask)
+        {
+            WatchdogTrace::Record(TRACE_WITHHELD, m_ulLateTask, ulNowUs);
+        }
+    }
+
+    return bRequested;
+}
+
+} //CpfBsp;
+
+
+#endif //__WATCHDOG_SUPERVISOR_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
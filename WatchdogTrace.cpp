@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogTrace.cpp
+///
+/// @see WatchdogTrace.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Added the .noinit region and made the attached region atomic
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "WatchdogTrace.hpp"
+#include "Watchdog.hpp"
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+    std::atomic<WatchdogTraceRegion *> WatchdogTrace::m_pRegion(0);
+
+    // Not initialized here or by the startup code, Attach validates it
+    WatchdogTraceRegion WatchdogTrace::m_NoInitRegion WATCHDOG_TRACE_NOINIT;
+
+    //**********************************************************************************************************************
+    // Public methods
+    //**********************************************************************************************************************
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogTrace::Attach
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool WatchdogTrace::Attach(WatchdogTraceRegion * pRegion)
+    {
+        bool bKept = false;
+
+        if (pRegion != 0)
+        {
+            if (pRegion->ulMagic == REGION_MAGIC)
+            {
+                bKept = true;
+            }
+            else
+            {
+                for (uint32_t ulSlot = 0; ulSlot < WATCHDOG_TRACE_ENTRY_COUNT; ++ulSlot)
+                {
+                    pRegion->aulEntries[ulSlot].store(0u, std::memory_order_relaxed);
+                }
+
+                pRegion->ulNext.store(0u, std::memory_order_relaxed);
+                pRegion->ulMagic = REGION_MAGIC;
+            }
+        }
+
+        m_pRegion.store(pRegion, std::memory_order_release);
+
+        return bKept;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogTrace::RecordBoot
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void WatchdogTrace::RecordBoot(uint32_t ulNowUs)
+    {
+        // The status flags are the top two bits of the register, which fit the id once shifted down
+        Record(TRACE_BOOT, static_cast<uint32_t>(Watchdog::GetResetStatus()) >> 8, ulNowUs);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogTrace::Decode
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t WatchdogTrace::Decode(WatchdogTraceEvent * pEvents, uint32_t ulMaxEvents)
+    {
+        uint32_t              ulFound = 0;
+        WatchdogTraceRegion * pRegion = m_pRegion.load(std::memory_order_acquire);
+
+        if (pRegion != 0)
+        {
+            uint32_t ulLimit = (ulMaxEvents < WATCHDOG_TRACE_ENTRY_COUNT) ? ulMaxEvents : WATCHDOG_TRACE_ENTRY_COUNT;
+            uint32_t ulNext = pRegion->ulNext.load(std::memory_order_acquire);
+            uint32_t ulNewerTime = 0;
+            uint32_t ulAgeUs = 0;
+            bool     bDone = (ulLimit == 0u);
+
+            //
+            // Walk back from the newest entry to an empty slot or the start of the run, filling the buffer from the
+            // end so it comes out oldest first.
+            //
+            while (!bDone)
+            {
+                uint32_t ulEntry = pRegion->aulEntries[(ulNext - 1u - ulFound) & ENTRY_MASK].load(
+                                       std::memory_order_relaxed);
+                uint32_t ulType = ulEntry >> TYPE_SHIFT;
+                uint32_t ulTime = ulEntry & TIME_MASK;
+
+                if ((ulType == TRACE_EMPTY) || (ulType > TRACE_WITHHELD))
+                {
+                    bDone = true;
+                }
+                else
+                {
+                    ulAgeUs += (ulFound != 0u) ? (((ulNewerTime - ulTime) & TIME_MASK) * TIME_RESOLUTION_US) : 0u;
+                    ulNewerTime = ulTime;
+
+                    WatchdogTraceEvent & rEvent = pEvents[ulLimit - 1u - ulFound];
+
+                    rEvent.eType = static_cast<WatchdogTraceType>(ulType);
+                    rEvent.ulId = (ulEntry >> ID_SHIFT) & ID_MASK;
+                    rEvent.ulAgeUs = ulAgeUs;
+
+                    ++ulFound;
+                    bDone = (ulType == TRACE_BOOT) || (ulFound == ulLimit);
+                }
+            }
+
+            // Move the entries found down to the start of the buffer
+            for (uint32_t ulIndex = 0; (ulFound != ulLimit) && (ulIndex < ulFound); ++ulIndex)
+            {
+                pEvents[ulIndex] = pEvents[ulLimit - ulFound + ulIndex];
+            }
+        }
+
+        return ulFound;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// WatchdogTrace::ReadResetReport
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    bool WatchdogTrace::ReadResetReport(WatchdogResetReport & rReport)
+    {
+        rReport.uwStatus = Watchdog::GetResetStatus();
+        rReport.ulEventCount = Decode(rReport.aEvents, WATCHDOG_TRACE_ENTRY_COUNT);
+
+        return (rReport.uwStatus != 0u);
+    }
+};
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
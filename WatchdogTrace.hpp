@@ -0,0 +1,286 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogTrace.hpp
+///
+/// Description Reset forensics trace of watchdog activity in memory that survives a reset
+///
+/// @par Full Description
+/// Class header for the WatchdogTrace class, a ring of the last watchdog kicks and task check-ins kept in memory that
+/// is not initialized at startup, so that after a watchdog reset the events leading up to it can be read back
+/// alongside the IWDT status flags.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 One recording context, and a .noinit region for the target
+/// - agent 16-Oct-2026 Added the caller ids of the CpfBsp kick paths
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WATCHDOG_TRACE_HPP__
+#define __WATCHDOG_TRACE_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+#include <atomic>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+// Kind of a trace entry, 0 marks a slot never written
+enum WatchdogTraceType
+{
+    TRACE_EMPTY    = 0,     ///< Slot never written
+    TRACE_BOOT     = 1,     ///< Start of a run, the id holds the IWDT status flags found at startup
+    TRACE_KICK     = 2,     ///< Hardware watchdog refreshed, the id is the caller
+    TRACE_CHECK_IN = 3,     ///< Supervisor collected a task's check-in, the id is the task
+    TRACE_WITHHELD = 4      ///< Supervisor withheld the refresh, the id is the late task
+};
+
+// Caller ids of the refreshes made by the CpfBsp kick paths, application callers of KickWatchdog use ids below 0xFC
+static const uint32_t TRACE_CALLER_PERIODIC_KICKER = 0xFCu;     ///< PeriodicKicker::Tick
+static const uint32_t TRACE_CALLER_MONITOR         = 0xFDu;     ///< WatchdogMonitor::KickWatchdog
+static const uint32_t TRACE_CALLER_SCHEDULER       = 0xFEu;     ///< KickScheduler::Tick
+
+// Number of entries in the trace ring, a power of two
+static const uint32_t WATCHDOG_TRACE_ENTRY_COUNT = 64u;
+
+// Section of the target's trace region, which the linker script must leave out of the startup zeroing and copying
+#if !defined(WATCHDOG_TRACE_SECTION)
+#define WATCHDOG_TRACE_SECTION ".noinit"
+#endif
+
+// Places a definition in WATCHDOG_TRACE_SECTION
+#if defined(__GNUC__)
+#define WATCHDOG_TRACE_NOINIT __attribute__((section(WATCHDOG_TRACE_SECTION)))
+#else
+#define WATCHDOG_TRACE_NOINIT
+#endif
+
+// Trace ring as laid out in persistent memory, in WATCHDOG_TRACE_SECTION on the target or a mapped file on the host
+struct WatchdogTraceRegion
+{
+    uint32_t              ulMagic;                                      ///< WatchdogTrace::REGION_MAGIC once valid
+    std::atomic<uint32_t> ulNext;                                       ///< Free running index of the next entry
+    std::atomic<uint32_t> aulEntries[WATCHDOG_TRACE_ENTRY_COUNT];       ///< Packed entries
+};
+
+// One decoded trace entry
+struct WatchdogTraceEvent
+{
+    WatchdogTraceType eType;    ///< What happened
+    uint32_t          ulId;     ///< Caller, task or status flags, by type
+    uint32_t          ulAgeUs;  ///< Time before the newest entry, to WatchdogTrace::TIME_RESOLUTION_US
+};
+
+// What was found at startup about the previous run
+struct WatchdogResetReport
+{
+    uint16_t           uwStatus;                                    ///< IWDT status flags, Watchdog::GetResetStatus
+    uint32_t           ulEventCount;                                ///< Entries in aEvents
+    WatchdogTraceEvent aEvents[WATCHDOG_TRACE_ENTRY_COUNT];         ///< Previous run, oldest first
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WatchdogTrace: WatchdogTrace
+///
+/// Records watchdog kicks and check-ins in a persistent ring for reading back after a reset
+///
+/// @par Full Description
+/// Each entry is one 32 bit word: the type in the top 4 bits, an 8 bit id and the low 20 bits of the time in units
+/// of TIME_RESOLUTION_US, which spans about 16 seconds, longer than any IWDT timeout.  Recording writes the entry
+/// with one 32 bit store and then advances the index with another, so a reset between the two loses the entry
+/// rather than leaving a torn one.  Until a region is attached, recording is a load and a branch.
+///
+/// Recording uses only atomic loads and stores, no read-modify-write, see SampleRing, since it sits on the
+/// production kick path.  The price is that the trace has one writer: Record is only
+/// called from the context that refreshes the watchdog, which is where Watchdog::KickWatchdog records and where
+/// WatchdogSupervisor::Service runs, before KickScheduler::Tick.  Decode may run anywhere.
+///
+/// The region is memory the startup code does not clear: on the target the built in region placed in
+/// WATCHDOG_TRACE_SECTION, attached with AttachNoInitRegion, on the host a mapped file (Host::WatchdogTraceFile).
+/// Attach validates it, so the random contents of memory after a power on are discarded rather than decoded.
+///
+/// At startup, attach the region, call ReadResetReport to get the status flags together with the entries of the run
+/// that ended in the reset, then call RecordBoot to mark the start of the new run.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class WatchdogTrace
+{
+    public:
+        //**************************************************************************************************************
+        // Public definitions
+        //**************************************************************************************************************
+
+        // Marks a region that has been initialized
+        static const uint32_t REGION_MAGIC = 0x57445452u;
+
+        // Time resolution of an entry
+        static const uint32_t TIME_RESOLUTION_US = 16u;
+
+        //**************************************************************************************************************
+        // Public methods
+        //**************************************************************************************************************
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTrace::Attach
+        ///
+        /// @par Full Description
+        /// Records to pRegion from now on.  A region without the magic word is cleared and initialized, a valid one
+        /// keeps its entries.
+        ///
+        /// @pre    Called from the recording context, or while it is not running, so that no Record is still writing
+        ///         to a region being detached.
+        /// @post   Recording enabled.
+        ///
+        /// @param  [in]  pRegion   Persistent region, NULL to stop recording.
+        ///
+        /// @return whether the region held a trace from before
+        /// @retval true:  the previous entries were kept
+        /// @retval false: the region was initialized empty, or pRegion is NULL
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool Attach(WatchdogTraceRegion * pRegion);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTrace::AttachNoInitRegion
+        ///
+        /// @par Full Description
+        /// Attaches the region built into WATCHDOG_TRACE_SECTION, the persistent region of the target.
+        ///
+        /// @return whether the region held a trace from before, see Attach
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool AttachNoInitRegion(void) { return Attach(&m_NoInitRegion); }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTrace::Record
+        ///
+        /// @par Full Description
+        /// Appends an entry, overwriting the oldest once the ring is full.
+        ///
+        /// @pre    Called from the one recording context, the one that refreshes the watchdog.
+        ///
+        /// @param  [in]  eType     Kind of entry.
+        /// @param  [in]  ulId      Caller or task, the low 8 bits are kept.
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void Record(WatchdogTraceType eType, uint32_t ulId, uint32_t ulNowUs)
+        {
+            WatchdogTraceRegion * pRegion = m_pRegion.load(std::memory_order_acquire);
+
+            if (pRegion != 0)
+            {
+                // The only writer, so a plain load and store of the index, with the entry stored first
+                uint32_t ulNext = pRegion->ulNext.load(std::memory_order_relaxed);
+
+                pRegion->aulEntries[ulNext & ENTRY_MASK].store((static_cast<uint32_t>(eType) << TYPE_SHIFT) |
+                                                               ((ulId & ID_MASK) << ID_SHIFT) |
+                                                               ((ulNowUs / TIME_RESOLUTION_US) & TIME_MASK),
+                                                               std::memory_order_relaxed);
+                pRegion->ulNext.store(ulNext + 1u, std::memory_order_release);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTrace::RecordBoot
+        ///
+        /// @par Full Description
+        /// Marks the start of a run with the IWDT status flags, so later decodes stop at it.
+        ///
+        /// @param  [in]  ulNowUs   Current time in microseconds.
+        ///
+        /// @return none
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void RecordBoot(uint32_t ulNowUs);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTrace::Decode
+        ///
+        /// @par Full Description
+        /// Unpacks the entries of the current run, back to and including the last TRACE_BOOT.  Ages are found by
+        /// walking back from the newest entry, so they assume no two successive entries are further apart than the
+        /// 20 bit time span.
+        ///
+        /// @param  [out] pEvents       Buffer for the entries, oldest first.
+        /// @param  [in]  ulMaxEvents   Capacity of pEvents, the newest entries are kept when it is too small.
+        ///
+        /// @return number of entries written
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static uint32_t Decode(WatchdogTraceEvent * pEvents, uint32_t ulMaxEvents);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// FUNCTION NAME: WatchdogTrace::ReadResetReport
+        ///
+        /// @par Full Description
+        /// Reads the IWDT status flags and decodes the trace of the run that ended in the last reset.
+        ///
+        /// @pre    Called at startup after Attach and before RecordBoot.
+        ///
+        /// @param  [out] rReport   Status flags and previous run.
+        ///
+        /// @return whether the reset was a watchdog reset
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool ReadResetReport(WatchdogResetReport & rReport);
+
+    private:
+
+        //**************************************************************************************************************
+        // Private definitions
+        //**************************************************************************************************************
+
+        // Entry fields
+        static const uint32_t TYPE_SHIFT = 28u;
+        static const uint32_t ID_SHIFT   = 20u;
+        static const uint32_t ID_MASK    = 0xFFu;
+        static const uint32_t TIME_MASK  = 0xFFFFFu;
+
+        static const uint32_t ENTRY_MASK = WATCHDOG_TRACE_ENTRY_COUNT - 1u;
+
+        static_assert((WATCHDOG_TRACE_ENTRY_COUNT & ENTRY_MASK) == 0u, "The trace ring size must be a power of two");
+
+        // Region recorded to, NULL when not attached
+        static std::atomic<WatchdogTraceRegion *> m_pRegion;
+
+        // Persistent region of the target, in WATCHDOG_TRACE_SECTION
+        static WatchdogTraceRegion                m_NoInitRegion;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogTrace::WatchdogTrace
+        ///
+        /// Constructor
+        ///
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        WatchdogTrace() {}
+
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// METHOD NAME: WatchdogTrace::~WatchdogTrace
+        ///
+        /// Destructor
+        ///
+        ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~WatchdogTrace() {}
+
+        // Inhibit copy constructor and assignment operator
+        WatchdogTrace(WatchdogTrace &);
+
+        WatchdogTrace & operator=(WatchdogTrace const&); // assign op. hidden
+};
+} //CpfBsp;
+
+
+#endif //__WATCHDOG_TRACE_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
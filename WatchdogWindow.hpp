@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file WatchdogWindow.hpp
+///
+/// Description Independent watchdog refresh window definitions
+///
+/// @par Full Description
+/// The OFS0 register fixes the independent watchdog timeout and the window within each timeout period during which
+/// a refresh is permitted.  This file describes those settings for the software that has to schedule refreshes.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - agent 16-Oct-2026 Original implementation
+/// - agent 16-Oct-2026 Window arithmetic made constexpr for WatchdogPolicy
+/// @endif
+///
+/// @ingroup CpfBsp
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __WATCHDOG_WINDOW_HPP__
+#define __WATCHDOG_WINDOW_HPP__
+// SYSTEM INCLUDES
+#include <stdint.h>
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+// (none)
+
+namespace CpfBsp
+{
+// FORWARD REFERENCES
+// (none)
+
+// Refresh window beginning, in percent of the watchdog timer cycle elapsed
+enum WindowStart
+{
+    WINDOW_START_0  = 0,
+    WINDOW_START_25 = 25,
+    WINDOW_START_50 = 50,
+    WINDOW_START_75 = 75
+};
+
+// Refresh window end, in percent of the watchdog timer cycle elapsed
+enum WindowEnd
+{
+    WINDOW_END_25  = 25,
+    WINDOW_END_50  = 50,
+    WINDOW_END_75  = 75,
+    WINDOW_END_100 = 100
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// WatchdogWindow: WatchdogWindow
+///
+/// Timeout and refresh window of the independent watchdog
+///
+/// @par Full Description
+/// Times are microseconds from the start of a watchdog timer cycle, which is the last refresh or the reset.  A
+/// refresh is permitted from GetOpenUs() to GetCloseUs().  See Watchdog::KickWatchdog for the window combinations
+/// OFS0 supports; the window end must be after the window beginning.
+///
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct WatchdogWindow
+{
+    uint32_t    ulTimeoutUs;    ///< Watchdog timer cycle in microseconds
+    WindowStart eStart;         ///< Refresh window beginning
+    WindowEnd   eEnd;           ///< Refresh window end
+
+    // Percent of the cycle represented by the whole cycle
+    static const uint32_t CYCLE_PERCENT = 100u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: WatchdogWindow::GetOpenUs
+    ///
+    /// @return time into the cycle at which refreshing becomes permitted
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr uint32_t GetOpenUs(void) const
+    {
+        return static_cast<uint32_t>((static_cast<uint64_t>(ulTimeoutUs) * eStart) / CYCLE_PERCENT);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: WatchdogWindow::GetCloseUs
+    ///
+    /// @return time into the cycle at which refreshing stops being permitted
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr uint32_t GetCloseUs(void) const
+    {
+        return static_cast<uint32_t>((static_cast<uint64_t>(ulTimeoutUs) * eEnd) / CYCLE_PERCENT);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: WatchdogWindow::GetMidpointUs
+    ///
+    /// @return time into the cycle halfway through the refresh window, the point furthest from both edges
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr uint32_t GetMidpointUs(void) const
+    {
+        return GetOpenUs() + ((GetCloseUs() - GetOpenUs()) / 2u);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// FUNCTION NAME: WatchdogWindow::IsRefreshPermitted
+    ///
+    /// @param  [in]  ulElapsedUs  Time since the start of the cycle in microseconds.
+    ///
+    /// @return whether a refresh at ulElapsedUs is inside the window
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr bool IsRefreshPermitted(uint32_t ulElapsedUs) const
+    {
+        return (ulElapsedUs >= GetOpenUs()) && (ulElapsedUs <= GetCloseUs());
+    }
+};
+
+} //CpfBsp;
+
+
+#endif //__WATCHDOG_WINDOW_HPP__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// End of file.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////